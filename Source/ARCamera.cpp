@@ -1,125 +1,209 @@
-/*==================================================================================//
-ARCamera.cpp
- - DESCRIPTION: ARCamera class member function implementations.
- - AUTHOR: Glen K.Straughn
- - DATE: 05/23/2017
- - COMPILER: Visual Studio 2015
-//==================================================================================*/
-
-#include"ARCamera.hpp"
-
-#include<AR/video.h>
-#include<string>
-
-#include "Util.hpp"
-
-
-ARCamera::ARCamera(std::string cameraParameters)
-{
-	ARParam cameraParam;
-
-	// OPEN VIDEO
-	if (arVideoOpen("") < 0)
-	{
-		throw(CameraInitError::VIDEO_OPEN_ERROR);
-	}
-
-	// GET WIDTH AND HEIGHT
-	int imageWidth, imageHeight;
-	if (arVideoGetSize(&imageWidth, &imageHeight) < 0)
-	{
-		throw(CameraInitError::VIDEO_GET_SIZE_ERROR);
-		arVideoClose();
-	}
-
-	// GET PIXEL FORMAT
-	m_pixelFormat = arVideoGetPixelFormat();
-	if (m_pixelFormat == AR_PIXEL_FORMAT_INVALID)
-	{
-		throw(CameraInitError::VIDEO_PIXEL_FORMAT_ERROR);
-		arVideoClose();
-	}
-
-	// LOAD PARAMETERS FROM FILE
-	if (arParamLoad(cameraParameters.c_str(), 1, &cameraParam) < 0)
-	{
-		throw(CameraInitError::AR_PARAM_LOAD_ERROR);
-		arVideoClose();
-	}
-	// RESIZE IF NECESSARY
-	if (cameraParam.xsize != imageWidth || cameraParam.ysize != imageHeight)
-	{
-		arParamChangeSize(&cameraParam, imageWidth, imageHeight, &cameraParam);
-	}
-
-	if ( (mp_cameraParamLT = arParamLTCreate(&cameraParam, AR_PARAM_LT_DEFAULT_OFFSET)) == NULL)
-	{
-		throw(CameraInitError::AR_PARAM_LT_CREATE_ERROR);
-		arVideoClose();
-	}
-}
-
-
-//---------------------------------------------------------------------------------//
-
-
-ARCamera::~ARCamera()
-{
-	arVideoClose();
-	arParamLTFree(&mp_cameraParamLT);
-}
-
-//---------------------------------------------------------------------------------//
-
-bool ARCamera::startCamera()
-{
-	if (arVideoCapStart() != 0)
-	{
-		return false;
-	}
-	
-	m_cameraRunning = true;
-	return true;
-}
-
-
-//---------------------------------------------------------------------------------//
-
-
-void ARCamera::stopCamera()
-{
-	m_cameraRunning = false;
-	arVideoCapStop();
-}
-
-
-//---------------------------------------------------------------------------------//
-
-
-void ARCamera::getCameraFrame(Image &imageToUpdate)
-{
-	
-	if (imageToUpdate.getWidth() != mp_cameraParamLT->param.xsize || imageToUpdate.getHeight() != mp_cameraParamLT->param.ysize)
-	{
-		throw(Error::DimensionsMismatchException());
-	}
-	else if (imageToUpdate.getColorDepth() != arUtilGetPixelSize(m_pixelFormat))
-	{
-		throw(Error::DimensionsMismatchException(std::string("Dimension mismatch: color depth")));
-	}
-	else
-	{
-		ubyte* p_pixels = imageToUpdate.getPixelBuffer();
-		ARUint8* p_capImage = arVideoGetImage();
-
-		if (p_capImage != nullptr)
-		{
-			memcpy(p_pixels, p_capImage, imageToUpdate.getSize());
-		}
-		else
-		{
-			throw(Error::ARNullPointerException(std::string("ARNullPointer Exception in getCameraFrame()")));
-		}
-	}
-
+/*==================================================================================//
+ARCamera.cpp
+ - DESCRIPTION: ARCamera class member function implementations.
+ - AUTHOR: Glen K.Straughn
+ - DATE: 05/23/2017
+ - COMPILER: Visual Studio 2015
+//==================================================================================*/
+
+#include"ARCamera.hpp"
+
+#include<AR/video.h>
+#include<string>
+
+#include "Util.hpp"
+#include "Telemetry.hpp"
+
+
+ARCamera::ARCamera(std::string cameraParameters, FrameSource* p_frameSource)
+{
+	ARParam cameraParam;
+
+	m_cameraRunning = false;
+	m_frameDelivered = false;
+	m_frameSequence = 0;
+	mp_frameSource = (p_frameSource != NULL) ? p_frameSource : new ARVideoFrameSource();
+
+	// OPEN VIDEO
+	if (!mp_frameSource->open())
+	{
+		releaseFrameSource();
+		throw(CameraInitError::VIDEO_OPEN_ERROR);
+	}
+
+	// GET WIDTH AND HEIGHT
+	int imageWidth = mp_frameSource->getWidth();
+	int imageHeight = mp_frameSource->getHeight();
+	if (imageWidth <= 0 || imageHeight <= 0)
+	{
+		releaseFrameSource();
+		throw(CameraInitError::VIDEO_GET_SIZE_ERROR);
+	}
+
+	// GET PIXEL FORMAT
+	m_pixelFormat = mp_frameSource->getPixelFormat();
+	if (m_pixelFormat == AR_PIXEL_FORMAT_INVALID)
+	{
+		releaseFrameSource();
+		throw(CameraInitError::VIDEO_PIXEL_FORMAT_ERROR);
+	}
+
+	// LOAD PARAMETERS FROM FILE
+	if (arParamLoad(cameraParameters.c_str(), 1, &cameraParam) < 0)
+	{
+		releaseFrameSource();
+		throw(CameraInitError::AR_PARAM_LOAD_ERROR);
+	}
+	// RESIZE IF NECESSARY
+	if (cameraParam.xsize != imageWidth || cameraParam.ysize != imageHeight)
+	{
+		arParamChangeSize(&cameraParam, imageWidth, imageHeight, &cameraParam);
+	}
+
+	if ( (mp_cameraParamLT = arParamLTCreate(&cameraParam, AR_PARAM_LT_DEFAULT_OFFSET)) == NULL)
+	{
+		releaseFrameSource();
+		throw(CameraInitError::AR_PARAM_LT_CREATE_ERROR);
+	}
+}
+
+
+//---------------------------------------------------------------------------------//
+
+
+ARCamera::~ARCamera()
+{
+	releaseFrameSource();
+	arParamLTFree(&mp_cameraParamLT);
+}
+
+
+//---------------------------------------------------------------------------------//
+
+
+void ARCamera::releaseFrameSource()
+{
+	if (mp_frameSource != NULL)
+	{
+		mp_frameSource->close();
+		delete mp_frameSource;
+		mp_frameSource = NULL;
+	}
+}
+
+
+//---------------------------------------------------------------------------------//
+
+bool ARCamera::startCamera()
+{
+	if (!mp_frameSource->startCapture())
+	{
+		return false;
+	}
+	
+	m_cameraRunning = true;
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------//
+
+
+void ARCamera::stopCamera()
+{
+	m_cameraRunning = false;
+	mp_frameSource->stopCapture();
+}
+
+
+//---------------------------------------------------------------------------------//
+
+
+void ARCamera::getCameraFrame(Image &imageToUpdate)
+{
+	if (!tryGetCameraFrame(imageToUpdate))
+	{
+		throw(Error::ARNullPointerException(std::string("ARNullPointer Exception in getCameraFrame()")));
+	}
+}
+
+
+//---------------------------------------------------------------------------------//
+
+
+bool ARCamera::tryGetCameraFrame(Image &imageToUpdate)
+{
+	checkFrameDimensions(imageToUpdate);
+
+	ARUint8* p_capImage = acquireNewImage();
+
+	if (p_capImage == nullptr)
+	{
+		return false;
+	}
+
+	imageToUpdate.copyFrom(p_capImage);
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------//
+
+
+bool ARCamera::getCameraFrameView(Image &view)
+{
+	checkFrameDimensions(view);
+
+	ARUint8* p_capImage = acquireNewImage();
+
+	if (p_capImage == nullptr)
+	{
+		return false;
+	}
+
+	view.wrap(p_capImage);
+	return true;
+}
+
+
+//---------------------------------------------------------------------------------//
+
+
+ARUint8* ARCamera::acquireNewImage()
+{
+	ARUint8* p_capImage = mp_frameSource->getImage();
+
+	if (p_capImage == nullptr)
+	{
+		return nullptr;
+	}
+
+	if (m_frameDelivered && mp_frameSource->getFrameSequence() == m_frameSequence)
+	{
+		getTelemetry().count(TelemetryCounter::DUPLICATE_FRAMES);
+		return nullptr; // Already processed; skip the copy and everything after it.
+	}
+
+	m_frameDelivered = true;
+	m_frameSequence = mp_frameSource->getFrameSequence();
+	m_frameTimestamp = mp_frameSource->getFrameTimestamp();
+	getTelemetry().count(TelemetryCounter::FRAMES_CAPTURED);
+
+	return p_capImage;
+}
+
+
+//---------------------------------------------------------------------------------//
+
+
+void ARCamera::checkFrameDimensions(Image &image)
+{
+	if (image.getWidth() != mp_cameraParamLT->param.xsize || image.getHeight() != mp_cameraParamLT->param.ysize)
+	{
+		throw(Error::DimensionsMismatchException());
+	}
+	else if (image.getColorDepth() != arUtilGetPixelSize(m_pixelFormat))
+	{
+		throw(Error::DimensionsMismatchException(std::string("Dimension mismatch: color depth")));
+	}
 }
\ No newline at end of file
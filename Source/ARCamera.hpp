@@ -1,50 +1,81 @@
-/*================================================================================//
-ARCamera
- - DESCRIPTION: Class used to manage a camera using ARToolkit.
- - AUTHOR: Glen K. Straughn
- - DATE: 4/6/2017
- - COMPILER: Visual Studio 2015
-//================================================================================*/
-
-#pragma once
-#include <string>
-#include <AR/video.h>
-
-#include "TypeDef.hpp"
-#include "Texture.hpp"
-
-class ARCamera
-{
-public:
-	ARCamera(std::string cameraParameters);
-	~ARCamera();
-
-	bool startCamera();
-	void stopCamera();
-
-	//Image getCameraFrame();
-	void getCameraFrame(Image &imageToUpdate);
-	
-	// GETTERS AND SETTERS
-	inline bool isCameraRunning() { return m_cameraRunning; }
-	inline ARParamLT *getCameraParamLTPtr() { return mp_cameraParamLT; }
-	inline AR_PIXEL_FORMAT getPixelFormat() { return m_pixelFormat; }
-
-private:
-	bool m_cameraRunning;
-	AR_PIXEL_FORMAT m_pixelFormat;
-	ARParamLT* mp_cameraParamLT;
-};
-
-
-//--------------------------------------------------------------------------------//
-
-// INITIALIZATION ERRORS
-enum class CameraInitError
-{
-	VIDEO_OPEN_ERROR,
-	VIDEO_GET_SIZE_ERROR,
-	VIDEO_PIXEL_FORMAT_ERROR,
-	AR_PARAM_LOAD_ERROR,
-	AR_PARAM_LT_CREATE_ERROR
+/*================================================================================//
+ARCamera
+ - DESCRIPTION: Class used to manage a camera using ARToolkit.
+ - AUTHOR: Glen K. Straughn
+ - DATE: 4/6/2017
+ - COMPILER: Visual Studio 2015
+//================================================================================*/
+
+#pragma once
+#include <string>
+#include <chrono>
+#include <AR/video.h>
+
+#include "TypeDef.hpp"
+#include "Texture.hpp"
+#include "FrameSource.hpp"
+
+class ARCamera
+{
+public:
+	// p_frameSource: Source to take frames from; ARCamera takes ownership of it.
+	//				  Opens the default video device through arVideo when NULL.
+	ARCamera(std::string cameraParameters, FrameSource* p_frameSource = NULL);
+	~ARCamera();
+
+	bool startCamera();
+	void stopCamera();
+
+	//Image getCameraFrame();
+	void getCameraFrame(Image &imageToUpdate);
+
+	// Same as getCameraFrame(), but returns false instead of throwing when no new frame is ready.
+	// A frame the source delivers a second time does not count as new.
+	bool tryGetCameraFrame(Image &imageToUpdate);
+
+	// Points a view image at the frame source's own buffer instead of copying it.
+	// The view is only valid until the next frame is requested from the camera.
+	// Returns false when no new frame is ready.
+	bool getCameraFrameView(Image &view);
+	
+	// GETTERS AND SETTERS
+	inline bool isCameraRunning() { return m_cameraRunning; }
+	inline ARParamLT *getCameraParamLTPtr() { return mp_cameraParamLT; }
+	inline AR_PIXEL_FORMAT getPixelFormat() { return m_pixelFormat; }
+	inline FrameSource* getFrameSourcePtr() { return mp_frameSource; }
+
+	// Source sequence number and capture time of the last frame handed out.
+	inline unsigned long long getFrameSequence() const { return m_frameSequence; }
+	inline std::chrono::steady_clock::time_point getFrameTimestamp() const { return m_frameTimestamp; }
+
+private:
+	bool m_cameraRunning;
+	AR_PIXEL_FORMAT m_pixelFormat;
+	ARParamLT* mp_cameraParamLT;
+	FrameSource* mp_frameSource;
+	bool m_frameDelivered;		// False until the first frame is handed out
+	unsigned long long m_frameSequence;
+	std::chrono::steady_clock::time_point m_frameTimestamp;
+
+	// Takes the newest frame from the source; NULL if there is none or it was already handed out.
+	ARUint8* acquireNewImage();
+
+	// Closes and deletes the frame source before a CameraInitError is thrown.
+	void releaseFrameSource();
+
+	// Throws DimensionsMismatchException if image cannot hold a camera frame.
+	void checkFrameDimensions(Image &image);
+};
+
+
+//--------------------------------------------------------------------------------//
+
+// INITIALIZATION ERRORS
+enum class CameraInitError
+{
+	VIDEO_OPEN_ERROR,
+	VIDEO_GET_SIZE_ERROR,
+	VIDEO_PIXEL_FORMAT_ERROR,
+	AR_PARAM_LOAD_ERROR,
+	AR_PARAM_LT_CREATE_ERROR
 };
\ No newline at end of file
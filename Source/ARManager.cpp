@@ -1,525 +1,2143 @@
-//================================================================================//
-// ARManager
-//	- Manager class for ARMarkers
-//--------------------------------------------------------------------------------//
-// AUTHOR: Glen Straughn
-// DATE: 01.16.2018
-// COMPILER: Microsoft Visual C++
-//--------------------------------------------------------------------------------//
-// NOTE: This class currently only supports glyph markers, because I have no reason
-//		 to incorporate NFT functionality.
-//================================================================================//
-
-#include "ARManager.hpp"
-
-#include <iostream>
-#include <yaml-cpp/yaml.h>
-
-ARManager::ARManager()
-{
-	m_running = false;
-	m_verbose = false;
-	m_errorTolerance = 1.0f;
-
-	mp_camera = nullptr;
-	mp_cameraFrame = nullptr;
-	mp_arHandle = nullptr;
-	mp_ar3dHandle = nullptr;
-
-	m_numberOfPasses = 1;
-	m_passIncrement = 20;
-	m_baseThreshold = 256 / 2;
-}
-
-
-//--------------------------------------------------------------------------------//
-
-
-bool ARManager::initCamera(const std::string &cameraParameterFilePath)
-{
-	try
-	{
-		if (mp_camera != NULL)
-		{
-			return false;
-		}
-
-		mp_camera = new ARCamera(cameraParameterFilePath);
-	}
-	catch (CameraInitError &errorCode)
-	{
-		switch (errorCode)
-		{
-		case CameraInitError::AR_PARAM_LOAD_ERROR:
-			std::cout << "CAMERA INIT: AR_PARAM_LOAD_ERROR." << std::endl;
-			break;
-
-		case CameraInitError::AR_PARAM_LT_CREATE_ERROR:
-			std::cout << "CAMERA INIT: AR_PARAM_LT_CREATE_ERROR" << std::endl;
-			break;
-
-		case CameraInitError::VIDEO_GET_SIZE_ERROR:
-			std::cout << "CAMERA INIT: VIDEO GET SIZE ERROR." << std::endl;
-			break;
-
-		case CameraInitError::VIDEO_OPEN_ERROR:
-			std::cout << "CAMERA INIT: VIDEO_OPEN_ERROR." << std::endl;
-			break;
-
-		case CameraInitError::VIDEO_PIXEL_FORMAT_ERROR:
-			std::cout << "CAMERA INIT: VIDEO_PIXEL_FORMAT_ERROR." << std::endl;
-			break;
-		}
-
-		return false;
-	}
-
-	if (  (mp_ar3dHandle = ar3DCreateHandle( &(mp_camera->getCameraParamLTPtr()->param) )) == NULL )
-	{
-		std::cout << "AR 3D Handle creation failed." << std::endl;
-		return false;
-	}
-
-	return true;
-}
-
-
-//--------------------------------------------------------------------------------//
-
-
-bool ARManager::initManager()
-{
-	ARPattHandle* p_patternHandle = arPattCreateHandle();
-	ARParamLT* p_cameraParam = mp_camera->getCameraParamLTPtr();
-	mp_arHandle = arCreateHandle(p_cameraParam);
-	arPattAttach(mp_arHandle, p_patternHandle);
-
-	if (mp_arHandle == nullptr)
-	{
-		return false;
-	}
-
-	Image::ColorDepth colorDepth;
-	int height, width;
-	colorDepth = (Image::ColorDepth)arUtilGetPixelSize(mp_camera->getPixelFormat());
-	height = p_cameraParam->param.ysize;
-	width = p_cameraParam->param.xsize;
-
-	mp_cameraFrame = new Image(width, height, colorDepth);
-	if (mp_cameraFrame == nullptr)
-	{
-		return false;
-	}
-
-	arGetLabelingThresh(mp_arHandle, &m_baseThreshold);
-
-	return true;
-}
-
-
-//--------------------------------------------------------------------------------//
-
-
-bool ARManager::loadMarkers(const std::string &markerFilePath)
-{
-	YAML::Node file;
-	std::string path, name;
-	MarkerType type;
-	ARMarker* p_nextMarker;
-	ARPose offset;
-
-	try
-	{
-		file = YAML::LoadFile(markerFilePath);
-	}
-	catch (YAML::BadFile &ex)
-	{
-		return false;
-	}
-	catch (YAML::ParserException &ex)
-	{
-		return false;
-	}
-	catch (YAML::BadSubscript &ex)
-	{
-		return false;
-	}
-
-	// INITIALIZATION LOOP
-	for (int i = 0; i < file.size(); i++)
-	{
-		p_nextMarker = NULL;
-		path = name = "";
-		offset = IDENTITY_MATRIX_4X4;
-
-		if (file[i]["File Path"])
-		{
-			path = file[i]["File Path"].as<std::string>();
-		}
-		if (file[i]["Type"])
-		{
-			type = parseType(file[i]["Type"].as<std::string>());
-		}
-		if (file[i]["Name"])
-		{
-			name = file[i]["Name"].as<std::string>();
-		}
-
-		try
-		{
-			switch (type)
-			{
-			case MarkerType::GLYPH:
-				p_nextMarker = new GlyphMarker(path.c_str(), mp_arHandle, name);
-				break;
-			case MarkerType::NFT:
-				// Not going to worry about this for the time being.
-				break;
-			default:
-				std::cout << "Marker of unknown type at index " << i << "." << std::endl;
-			} // End switch block
-		}
-		catch (Error::ARNullPointerException &ex)
-		{
-			std::cout << ex.what() << std::endl;
-			delete p_nextMarker;
-			p_nextMarker = NULL;
-		}
-
-
-		if (file[i]["Offset"])
-		{
-			for (int r = 0; r < 4; r++)
-			{
-				for (int c = 0; c < 4; c++)
-				{
-					offset[c][r] = file[i]["Offset"][r * 4 + c].as<double>();
-				}
-			}
-
-			p_nextMarker->setOffset(offset);
-		} // End offset condition
-
-		if (p_nextMarker != NULL)
-		{
-			m_markers.push_back(p_nextMarker);
-		}
-	}
-
-	if (m_markers.empty())
-	{
-		return false;
-	}
-
-	return true;
-}
-
-
-//--------------------------------------------------------------------------------//
-
-
-void ARManager::updateCameraFrame()
-{
-	if (mp_cameraFrame != nullptr)
-	{
-		mp_camera->getCameraFrame(*mp_cameraFrame);
-	}
-	else
-	{
-		throw(Error::Exception(std::string("Null pointer exception in updateCameraFrame(): camera not initialized!")));
-	}
-}
-
-
-//--------------------------------------------------------------------------------//
-
-
-void ARManager::updateMarkers()
-{
-	ARdouble transform[3][4];
-	ubyte* p_cameraFrame = mp_cameraFrame->getPixelBuffer(); // Syntactic sugar
-	ARfloat error;
-	int bestMatch;
-	ARInt32	markerNum;
-	ARMarkerInfo* p_markerInfo;
-
-	int threshold = m_baseThreshold;
-
-	// Reset all markers' errors to -1
-	for (int i = 0; i < m_markers.size(); i++)
-	{
-		m_markers[i]->setError(-1);
-	}
-
-	// MULTIPLE PASSES
-	for (int pass = 0; pass < m_numberOfPasses; pass++)
-	{
-		arSetLabelingThresh(mp_arHandle, threshold);
-		arDetectMarker(mp_arHandle, p_cameraFrame);
-		markerNum = arGetMarkerNum(mp_arHandle);
-		if ((p_markerInfo = arGetMarker(mp_arHandle)) == NULL) continue; // It can be null sometimes.
-		
-		// MATCH MARKERS TO RESULTS AND PICK BEST ONE
-		for (int i = 0; i < m_markers.size(); i++)
-		{
-			if (m_markers[i]->getType() != MarkerType::GLYPH) continue;
-			bestMatch = -1;
-
-			for (int j = 0; j < markerNum; j++)
-			{
-				if (p_markerInfo[j].id == ((GlyphMarker*)m_markers[i])->getARPatternID() && p_markerInfo[j].cf > m_errorTolerance)
-				{
-					if (m_markers[i]->getError() < p_markerInfo[j].cf)
-					{
-						m_markers[i]->setError(p_markerInfo[j].cf);
-						bestMatch = j;
-					}
-				}
-			} // END j loop
-
-			if (bestMatch != -1) // Suitible Match found
-			{
-				arGetTransMatSquare(mp_ar3dHandle, &p_markerInfo[bestMatch], 2.0, transform);
-				m_markers[i]->setTransform(makeGLMatrixFromAR(transform));
-			}
-		}// END i loop
-
-		threshold += m_passIncrement;
-	} //END of Pass
-
-
-	// UPDATE MARKER STATE
-	for (int i = 0; i < m_markers.size(); i++)
-	{
-		if (m_markers[i]->getError() >= 0)
-		{ 
-			switch (m_markers[i]->getState())
-			{
-			case MarkerState::LOST:
-			case MarkerState::UNREGISTERED:
-				m_markers[i]->setState(MarkerState::DETECTED);
-				break;
-			case MarkerState::DETECTED:
-				m_markers[i]->setState(MarkerState::TRACKING);
-				break;
-			}
-		}
-		else
-		{
-			switch (m_markers[i]->getState())
-			{
-			case MarkerState::DETECTED:
-			case MarkerState::TRACKING:
-				m_markers[i]->setState(MarkerState::LOST);
-				break;
-			case MarkerState::LOST:
-				m_markers[i]->setState(MarkerState::UNREGISTERED);
-			}
-		}
-
-		// PRINT OUT STUFF
-		if (m_verbose)
-		{ 
-			if (m_markers[i]->getState() == MarkerState::DETECTED)
-			{
-				std::cout << "Marker " << m_markers[i]->getMarkerID() << " detected." << endl;
-				std::cout << "CONFIDENCE: " << m_markers[i]->getError() << endl;
-			}
-			else if (m_markers[i]->getState() == MarkerState::LOST)
-			{
-				std::cout << "Marker " << m_markers[i]->getMarkerID() << " lost." << endl;
-			}
-		}
-	}
-}
-
-
-//--------------------------------------------------------------------------------//
-
-
-float ARManager::getMarkerError(int markerID) const
-{
-	for (int i = 0; i < m_markers.size(); i++)
-	{
-		if (m_markers[i]->getMarkerID() == markerID)
-		{
-			if (m_markers[i]->isValid())
-			{
-				return m_markers[i]->getError();
-			}
-			else
-			{
-				return -1;
-			}
-		}
-	}
-
-	return -1;
-}
-
-
-//--------------------------------------------------------------------------------//
-
-
-ARPose ARManager::getMarkerPose(int markerID) const
-{
-	for (int i = 0; i < m_markers.size(); i++)
-	{
-		if (m_markers[i]->getMarkerID() == markerID)
-		{
-			if (m_markers[i]->isValid() == false)
-				break;
-			else
-				return m_markers[i]->getPose();
-		}
-	}
-
-	return ZERO_MATRIX_4X4;
-}
-
-
-ARPose ARManager::getMarkerPose(const std::string &markerName) const
-{
-	for (int i = 0; i < m_markers.size(); i++)
-	{
-		if (m_markers[i]->getName() == markerName)
-		{
-			if (m_markers[i]->isValid() == false)
-				break;
-			else
-				return m_markers[i]->getPose();
-		}
-	}
-
-	return ZERO_MATRIX_4X4;
-}
-
-
-//---------------------------------------------------------------------------------//
-
-
-ARPose ARManager::getOffsetMarkerPose(int markerID) const
-{
-	for (int i = 0; i < m_markers.size(); i++)
-	{
-		if (m_markers[i]->getMarkerID() == markerID)
-		{
-			if (m_markers[i]->isValid() == false)
-				break;
-			else
-				return m_markers[i]->getOffsetPose();
-		}
-	}
-
-	return ZERO_MATRIX_4X4;
-}
-
-
-ARPose ARManager::getOffsetMarkerPose(const std::string &markerName) const
-{
-	for (int i = 0; i < m_markers.size(); i++)
-	{
-		if (m_markers[i]->getName() == markerName)
-		{
-			if (m_markers[i]->isValid() == false)
-				break;
-			else
-				return m_markers[i]->getOffsetPose();
-		}
-	}
-
-	return ZERO_MATRIX_4X4;
-}
-
-
-//---------------------------------------------------------------------------------//
-
-
-ARPose ARManager::getMarkerOffset(int markerNumber) const
-{
-	for (int i = 0; i < m_markers.size(); i++)
-	{
-		if (m_markers[i]->getMarkerID() == markerNumber)
-		{
-			return m_markers[i]->getOffset();
-		}
-	}
-
-	return ZERO_MATRIX_4X4;
-}
-
-
-ARPose ARManager::getMarkerOffset(const std::string &markerName) const
-{
-	for (int i = 0; i < m_markers.size(); i++)
-	{
-		if (m_markers[i]->getName() == markerName)
-		{
-			return m_markers[i]->getOffset();
-		}
-	}
-
-	return ZERO_MATRIX_4X4;
-}
-
-
-//---------------------------------------------------------------------------------//
-
-
-int ARManager::getMarkerPageNumber(std::string &markerName) const
-{
-	for (int i = 0; i < m_markers.size(); i++)
-	{
-		if (markerName == m_markers[i]->getName())
-		{
-			return m_markers[i]->getMarkerID();
-		}
-	}
-
-	return -1;
-}
-
-
-//--------------------------------------------------------------------------------//
-
-
-void ARManager::setBaseThreshold(unsigned int threshold)
-{
-	if (threshold < 0)
-	{
-		m_baseThreshold = 0;
-	}
-	else if (threshold > 255)
-	{
-		m_baseThreshold = 255;
-	}
-	else
-	{
-		m_baseThreshold = threshold;
-	}
-}
-
-
-//--------------------------------------------------------------------------------//
-
-
-bool ARManager::start()
-{
-	if (mp_camera->startCamera())
-	{
-		m_running = true;
-		return true;
-	}
-
-	return false;
-}
-
-
-//--------------------------------------------------------------------------------//
-
-
-void ARManager::stop()
-{
-	mp_camera->stopCamera();
-	m_running = false;
+//================================================================================//
+// ARManager
+//	- Manager class for ARMarkers
+//--------------------------------------------------------------------------------//
+// AUTHOR: Glen Straughn
+// DATE: 01.16.2018
+// COMPILER: Microsoft Visual C++
+//--------------------------------------------------------------------------------//
+// NOTE: This class currently only supports glyph markers, because I have no reason
+//		 to incorporate NFT functionality.
+//================================================================================//
+
+#include "ARManager.hpp"
+#include "MarkerCandidates.hpp"
+#include "Telemetry.hpp"
+
+#include <iostream>
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <yaml-cpp/yaml.h>
+
+static const ARdouble MAX_RIGID_BODY_ERROR = 100.0;	// Squared pixels; above it a face is likely misidentified
+static const float BACK_FACE_LIMIT = -0.2f;	// Facing cosine; a little past edge-on, for motion since last frame
+static const ARdouble SETTLED_RESIDUAL_FACTOR = 4.0;	// Times the residual target; a seeded first step below it has settled
+static const int SETTLED_MAX_ITERATIONS = 2;
+
+ARManager::ARManager()
+{
+	m_running = false;
+	m_verbose = false;
+	m_errorTolerance = 1.0f;
+
+	mp_camera = nullptr;
+	mp_cameraFrame = nullptr;
+	mp_framePool = nullptr;
+	mp_frameBuffer = nullptr;
+	mp_frameView = nullptr;
+	mp_arHandle = nullptr;
+	mp_ar3dHandle = nullptr;
+
+	m_numberOfPasses = 1;
+	m_passIncrement = 20;
+	m_baseThreshold = 256 / 2;
+	m_earlyTermination = false;
+	m_terminationConfidence = 0.7f;
+	m_thresholdMode = ThresholdMode::MANUAL;
+	m_thresholdRegionOnly = false;
+	m_thresholdPercentile = 0.05f;
+	m_labelingMethod = LabelingMethod::ARTOOLKIT;
+	m_patternBankEnabled = false;
+	m_rigidBodyPose = false;
+	m_rigidBodyValid = false;
+	m_continuousPose = false;
+	m_poseMaxIterations = 10;
+	m_poseResidualTarget = 0.1;
+	m_cornerTracking = false;
+	m_reidentifyInterval = 10;
+	m_maxCornerResidual = 20.0f;
+	m_visibilityCulling = false;
+	m_visibilityCutoff = 0.35f;
+	m_visibilityKnown = false;
+	m_patternHints = false;
+
+	m_threadedCapture = false;
+	m_zeroCopy = false;
+	m_lumaDetection = true;
+	m_lumaValid = false;
+	m_markersCurrent = false;
+	m_frameSequence = 0;
+	m_detectionPixelFormat = AR_PIXEL_FORMAT_INVALID;
+	m_pyramidLevel = 0;
+	mp_coarseParamLT = nullptr;
+	m_coarseLevel = 0;
+	m_roiTracking = false;
+	m_roiVelocity = true;
+	m_roiPadding = 8.0f;
+	m_fullSearchInterval = 10;
+	m_framesSinceFullSearch = 0;
+	m_tileRows = 1;
+	m_tileColumns = 1;
+	m_tileOverlap = 64;
+	m_detectionThreads = 0;
+	mp_threadPool = nullptr;
+	mp_frameRing = nullptr;
+	m_capturing = false;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+ARManager::~ARManager()
+{
+	stopCaptureThread();
+
+	for (int i = 0; i < m_markers.size(); i++)
+	{
+		delete m_markers[i];
+	}
+	m_markers.clear();
+
+	freePasses();
+	delete mp_threadPool;
+
+	delete mp_frameRing;
+	if (mp_framePool != nullptr)
+	{
+		mp_framePool->release(mp_frameBuffer);
+	}
+	delete mp_framePool;
+	delete mp_frameView;
+
+	delete mp_camera;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool ARManager::initCamera(const std::string &cameraParameterFilePath, FrameSource* p_frameSource)
+{
+	try
+	{
+		if (mp_camera != NULL)
+		{
+			delete p_frameSource;
+			return false;
+		}
+
+		mp_camera = new ARCamera(cameraParameterFilePath, p_frameSource);
+	}
+	catch (CameraInitError &errorCode)
+	{
+		switch (errorCode)
+		{
+		case CameraInitError::AR_PARAM_LOAD_ERROR:
+			std::cout << "CAMERA INIT: AR_PARAM_LOAD_ERROR." << std::endl;
+			break;
+
+		case CameraInitError::AR_PARAM_LT_CREATE_ERROR:
+			std::cout << "CAMERA INIT: AR_PARAM_LT_CREATE_ERROR" << std::endl;
+			break;
+
+		case CameraInitError::VIDEO_GET_SIZE_ERROR:
+			std::cout << "CAMERA INIT: VIDEO GET SIZE ERROR." << std::endl;
+			break;
+
+		case CameraInitError::VIDEO_OPEN_ERROR:
+			std::cout << "CAMERA INIT: VIDEO_OPEN_ERROR." << std::endl;
+			break;
+
+		case CameraInitError::VIDEO_PIXEL_FORMAT_ERROR:
+			std::cout << "CAMERA INIT: VIDEO_PIXEL_FORMAT_ERROR." << std::endl;
+			break;
+		}
+
+		return false;
+	}
+
+	if (  (mp_ar3dHandle = ar3DCreateHandle( &(mp_camera->getCameraParamLTPtr()->param) )) == NULL )
+	{
+		std::cout << "AR 3D Handle creation failed." << std::endl;
+		return false;
+	}
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool ARManager::initManager()
+{
+	ARPattHandle* p_patternHandle = arPattCreateHandle();
+	ARParamLT* p_cameraParam = mp_camera->getCameraParamLTPtr();
+	mp_arHandle = arCreateHandle(p_cameraParam);
+	arPattAttach(mp_arHandle, p_patternHandle);
+
+	if (mp_arHandle == nullptr)
+	{
+		return false;
+	}
+
+	Image::ColorDepth colorDepth;
+	int height, width;
+	colorDepth = (Image::ColorDepth)arUtilGetPixelSize(mp_camera->getPixelFormat());
+	height = p_cameraParam->param.ysize;
+	width = p_cameraParam->param.xsize;
+
+	// The frame buffer and the capture ring's three; FramePipeline reserves its own.
+	mp_framePool = new FramePool(width, height, colorDepth);
+	mp_framePool->reserve(4);
+	mp_frameBuffer = mp_framePool->acquire();
+	mp_frameView = new Image(nullptr, width, height, colorDepth);
+	if (mp_frameBuffer == nullptr || mp_frameView == nullptr)
+	{
+		return false;
+	}
+	mp_cameraFrame = mp_frameBuffer;
+	m_lumaPlane.resize(width, height, false);
+
+	int threshold;
+	arGetLabelingThresh(mp_arHandle, &threshold);
+	m_baseThreshold = threshold;
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool ARManager::loadMarkers(const std::string &markerFilePath)
+{
+	YAML::Node file;
+	std::string path, name;
+	MarkerType type;
+	ARMarker* p_nextMarker;
+	ARPose offset;
+	int barcodeID;
+	MatrixCodeType codeType;
+
+	try
+	{
+		file = YAML::LoadFile(markerFilePath);
+	}
+	catch (YAML::BadFile &ex)
+	{
+		return false;
+	}
+	catch (YAML::ParserException &ex)
+	{
+		return false;
+	}
+	catch (YAML::BadSubscript &ex)
+	{
+		return false;
+	}
+
+	// INITIALIZATION LOOP
+	for (int i = 0; i < file.size(); i++)
+	{
+		p_nextMarker = NULL;
+		path = name = "";
+		offset = IDENTITY_MATRIX_4X4;
+		barcodeID = -1;
+		codeType = MatrixCodeType::CODE_4x4_HAMMING;
+
+		if (file[i]["File Path"])
+		{
+			path = file[i]["File Path"].as<std::string>();
+		}
+		if (file[i]["Type"])
+		{
+			type = parseType(file[i]["Type"].as<std::string>());
+		}
+		if (file[i]["Name"])
+		{
+			name = file[i]["Name"].as<std::string>();
+		}
+		if (file[i]["Barcode ID"])
+		{
+			barcodeID = file[i]["Barcode ID"].as<int>();
+		}
+		if (file[i]["Code Type"])
+		{
+			codeType = parseMatrixCodeType(file[i]["Code Type"].as<std::string>());
+		}
+
+		try
+		{
+			switch (type)
+			{
+			case MarkerType::GLYPH:
+				p_nextMarker = new GlyphMarker(path.c_str(), mp_arHandle, name);
+				break;
+			case MarkerType::NFT:
+				// Not going to worry about this for the time being.
+				break;
+			case MarkerType::MATRIX_CODE:
+				for (ARMarker* p_marker : m_markers)
+				{
+					if (p_marker->getType() == MarkerType::MATRIX_CODE && ((MatrixCodeMarker*)p_marker)->getCodeType() == codeType
+						&& ((MatrixCodeMarker*)p_marker)->getBarcodeID() == barcodeID)
+					{
+						throw Error::Exception("Barcode ID " + numberToString(barcodeID) + " is already used by " + p_marker->getName());
+					}
+				}
+				p_nextMarker = new MatrixCodeMarker(barcodeID, codeType, name);
+				break;
+			default:
+				std::cout << "Marker of unknown type at index " << i << "." << std::endl;
+			} // End switch block
+		}
+		catch (Error::ARNullPointerException &ex)
+		{
+			std::cout << ex.what() << std::endl;
+			delete p_nextMarker;
+			p_nextMarker = NULL;
+		}
+		catch (Error::Exception &ex)
+		{
+			std::cout << "Marker at index " << i << ": " << ex.what() << std::endl;
+			delete p_nextMarker;
+			p_nextMarker = NULL;
+		}
+
+
+		if (p_nextMarker != NULL && file[i]["Offset"])
+		{
+			for (int r = 0; r < 4; r++)
+			{
+				for (int c = 0; c < 4; c++)
+				{
+					offset[c][r] = file[i]["Offset"][r * 4 + c].as<double>();
+				}
+			}
+
+			p_nextMarker->setOffset(offset);
+		} // End offset condition
+
+		if (p_nextMarker != NULL)
+		{
+			m_markers.push_back(p_nextMarker);
+		}
+	}
+
+	if (m_markers.empty())
+	{
+		return false;
+	}
+
+	if (m_patternBankEnabled)
+	{
+		m_patternBank.build(mp_arHandle->pattHandle);
+	}
+
+	m_matrixCodeTypes.clear();
+	for (ARMarker* p_marker : m_markers)
+	{
+		if (p_marker->getType() == MarkerType::MATRIX_CODE
+			&& std::find(m_matrixCodeTypes.begin(), m_matrixCodeTypes.end(), ((MatrixCodeMarker*)p_marker)->getCodeType()) == m_matrixCodeTypes.end())
+		{
+			m_matrixCodeTypes.push_back(((MatrixCodeMarker*)p_marker)->getCodeType());
+		}
+	}
+
+	// Faces of the rigid body, for culling
+	std::vector<ARPose> offsets;
+	m_cullerFaces.assign(m_markers.size(), -1);
+	for (int i = 0; i < m_markers.size(); i++)
+	{
+		if (m_markers[i]->hasOffset())
+		{
+			m_cullerFaces[i] = (int)offsets.size();
+			offsets.push_back(m_markers[i]->getOffset());
+		}
+	}
+	m_culler.setFaces(offsets);
+	m_visibilityKnown = false;
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::updateCameraFrame()
+{
+	if (m_capturing)
+	{
+		if (!mp_frameRing->acquireLatest())
+		{
+			throw(Error::ARNullPointerException(std::string("No new frame from capture thread in updateCameraFrame()")));
+		}
+		mp_cameraFrame = mp_frameRing->getReadBuffer();
+		m_frameSequence = mp_frameRing->getReadSequence();
+		m_frameTimestamp = mp_frameRing->getReadTimestamp();
+	}
+	else if (m_zeroCopy && mp_frameView != nullptr)
+	{
+		if (!mp_camera->getCameraFrameView(*mp_frameView))
+		{
+			throw(Error::ARNullPointerException(std::string("ARNullPointer Exception in updateCameraFrame()")));
+		}
+		mp_cameraFrame = mp_frameView;
+		m_frameSequence = mp_camera->getFrameSequence();
+		m_frameTimestamp = mp_camera->getFrameTimestamp();
+	}
+	else if (mp_frameBuffer != nullptr)
+	{
+		mp_camera->getCameraFrame(*mp_frameBuffer);
+		mp_cameraFrame = mp_frameBuffer;
+		m_frameSequence = mp_camera->getFrameSequence();
+		m_frameTimestamp = mp_camera->getFrameTimestamp();
+	}
+	else
+	{
+		throw(Error::Exception(std::string("Null pointer exception in updateCameraFrame(): camera not initialized!")));
+	}
+
+	m_markersCurrent = false;
+
+	// One conversion per frame, shared by detection and sampling.
+	m_lumaValid = m_lumaPlane.build(*mp_cameraFrame, mp_camera->getPixelFormat());
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::updateMarkers()
+{
+	ubyte* p_cameraFrame = mp_cameraFrame->getPixelBuffer(); // Syntactic sugar
+	ubyte* p_coarseFrame = NULL;
+	AR_PIXEL_FORMAT pixelFormat = mp_camera->getPixelFormat();
+	ARdouble transform[3][4];
+	ARdouble previousTransform[3][4];
+
+	if (m_markersCurrent)
+	{
+		return; // Already detected on this frame; the markers hold its results.
+	}
+	m_markersCurrent = true;
+	getTelemetry().count(TelemetryCounter::FRAMES_PROCESSED);
+
+	// Every frame joins the corner tracker's pyramids, so the next one can be tracked from it.
+	std::chrono::steady_clock::time_point cornerStart = std::chrono::steady_clock::now();
+	if (m_cornerTracking && m_lumaValid)
+	{
+		m_cornerTracker.nextFrame(m_lumaPlane);
+	}
+	else
+	{
+		m_cornerTracker.reset();
+	}
+	unsigned long long cornerTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - cornerStart).count();
+
+	// ROI tracking needs every visible marker to have been tracked last frame, and the luma plane.
+	bool fullSearch = !(m_roiTracking || m_cornerTracking) || !m_lumaValid || ++m_framesSinceFullSearch >= m_fullSearchInterval;
+	bool anyTracked = false;
+	for (int i = 0; i < m_markers.size(); i++)
+	{
+		fullSearch = fullSearch || m_markers[i]->getState() == MarkerState::LOST;
+		anyTracked = anyTracked || m_markers[i]->isValid();
+	}
+	fullSearch = fullSearch || !anyTracked;
+
+	if (fullSearch && m_passes.size() != m_numberOfPasses)
+	{
+		initPasses();
+	}
+
+	// The pyramid is built from the luma plane, and falls back to the full frame without it.
+	bool usePyramid = fullSearch && m_pyramidLevel > 0 && m_lumaValid && m_lumaPlane.hasHalfResolution()
+		&& (m_coarseLevel == m_pyramidLevel || initPyramid());
+	bool ownLabeling = fullSearch && m_labelingMethod != LabelingMethod::ARTOOLKIT && m_lumaValid && !usePyramid
+		&& (m_labelingMethod != LabelingMethod::ENGINE || (!m_passes.empty() && m_passes[0].p_engine != nullptr) || initEngines());
+
+	if ((m_lumaDetection || usePyramid || ownLabeling || !fullSearch) && m_lumaValid)
+	{
+		p_cameraFrame = m_lumaPlane.getPixels();
+		pixelFormat = AR_PIXEL_FORMAT_MONO;
+	}
+
+	if (pixelFormat != m_detectionPixelFormat)
+	{
+		arSetPixelFormat(mp_arHandle, pixelFormat);
+		arSetPatternDetectionMode(mp_arHandle, (pixelFormat == AR_PIXEL_FORMAT_MONO) ? AR_TEMPLATE_MATCHING_MONO : AR_TEMPLATE_MATCHING_COLOR);
+		m_detectionPixelFormat = pixelFormat;
+
+		for (int i = 0; i < m_passes.size(); i++)
+		{
+			if (m_passes[i].p_handle != mp_arHandle)
+			{
+				arSetPixelFormat(m_passes[i].p_handle, pixelFormat);
+				arSetPatternDetectionMode(m_passes[i].p_handle, mp_arHandle->arPatternDetectionMode);
+			}
+			if (m_passes[i].p_tiles != nullptr)
+			{
+				m_passes[i].p_tiles->setPixelFormat(pixelFormat);
+			}
+		}
+	}
+
+	// Tiles are created with mp_arHandle's current settings the first time a full-resolution search needs them.
+	if (fullSearch && !usePyramid && !ownLabeling && m_tileRows * m_tileColumns > 1 && !m_passes.empty() && m_passes[0].p_tiles == nullptr)
+	{
+		initTiling();
+	}
+
+	if (usePyramid)
+	{
+		p_coarseFrame = m_lumaPlane.getHalfPixels();
+		if (m_pyramidLevel == 2)
+		{
+			halveLuma(m_lumaPlane.getHalfPixels(), m_lumaPlane.getHalfWidth(), m_lumaPlane.getHalfHeight(), m_quarterPixels.data());
+			p_coarseFrame = m_quarterPixels.data();
+		}
+	}
+
+	// Markers expected in view: those visible last frame, or every glyph marker if none were.
+	std::vector<bool> expected(m_markers.size(), false);
+	bool anyExpected = false;
+	for (int i = 0; i < m_markers.size(); i++)
+	{
+		expected[i] = isSquare(m_markers[i]->getType()) && m_markers[i]->isValid();
+		anyExpected = anyExpected || expected[i];
+	}
+	for (int i = 0; i < m_markers.size() && !anyExpected; i++)
+	{
+		expected[i] = isSquare(m_markers[i]->getType());
+	}
+
+	// Last frame's pose tells which faces can be seen at all, and where the patterns should be.
+	m_visibilityKnown = false;
+	if (m_visibilityCulling || m_patternHints)
+	{
+		updateVisibility();
+	}
+	m_expectedPatterns.clear();
+	if (m_patternHints && m_patternBankEnabled)
+	{
+		predictPatterns();
+	}
+
+	// Reset all markers' errors to -1
+	m_detections.resize(m_markers.size());
+	m_detectionSteps.assign(m_markers.size(), -1);
+	m_cornerTrackAge.resize(m_markers.size(), 0);
+	std::vector<char> cornerTracked(m_markers.size(), 0);
+	for (int i = 0; i < m_markers.size(); i++)
+	{
+		m_markers[i]->setError(-1);
+	}
+
+	if (fullSearch)
+	{
+		m_framesSinceFullSearch = 0;
+
+		// MULTIPLE PASSES: the most productive alone when it may be enough, then the rest at once
+		selectThresholds();
+		orderPasses();
+		unsigned int passCount = (unsigned int)m_passes.size();
+		bool splitPasses = m_earlyTermination && passCount > 1 && !(ownLabeling && m_labelingMethod == LabelingMethod::COMPONENT_TREE); // The tree's extra thresholds are nearly free.
+		unsigned int firstWave = splitPasses ? 1 : passCount;
+		runPasses(0, firstWave, p_cameraFrame, p_coarseFrame);
+
+		if (passCount > 0 && m_passes[0].p_markerInfo != NULL) // It can be null sometimes.
+		{
+			applyDetections(m_passes[0].p_markerInfo, m_passes[0].markerNum, m_passes[0].step);
+		}
+
+		bool allFound = true;
+		for (int i = 0; i < m_markers.size(); i++)
+		{
+			allFound = allFound && (!expected[i] || m_markers[i]->getError() >= m_terminationConfidence);
+		}
+
+		if (firstWave < passCount && allFound)
+		{
+			getTelemetry().count(TelemetryCounter::SKIPPED_PASSES, passCount - firstWave);
+			passCount = firstWave;
+		}
+		else if (firstWave < passCount)
+		{
+			runPasses(firstWave, passCount - firstWave, p_cameraFrame, p_coarseFrame);
+		}
+		getTelemetry().count(TelemetryCounter::DETECTION_PASSES, passCount);
+
+		for (int i = 1; i < passCount; i++)
+		{
+			if (m_passes[i].p_markerInfo != NULL) // It can be null sometimes.
+			{
+				applyDetections(m_passes[i].p_markerInfo, m_passes[i].markerNum, m_passes[i].step);
+			}
+		}
+
+		for (int i = 0; i < m_markers.size(); i++)
+		{
+			if (m_detectionSteps[i] >= 0)
+			{
+				m_passWins[m_detectionSteps[i]]++;
+			}
+		}
+	}
+	else
+	{
+		// PREDICTED REGIONS OF INTEREST, or corner tracks while they stay reliable
+		for (int i = 0; i < m_markers.size(); i++)
+		{
+			if (isCulled(i, BACK_FACE_LIMIT)) continue;
+
+			cornerStart = std::chrono::steady_clock::now();
+			cornerTracked[i] = m_cornerTracking && m_cornerTrackAge[i] + 1 < m_reidentifyInterval && trackCorners(i, m_detections[i]);
+			cornerTime += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - cornerStart).count();
+
+			if (cornerTracked[i])
+			{
+				m_markers[i]->setError(m_detections[i].cf);
+				m_cornerTrackAge[i]++;
+			}
+			else if (trackMarker(i, m_detections[i]))
+			{
+				m_markers[i]->setError(m_detections[i].cf);
+			}
+		}
+	}
+
+	// Detected markers start their corner tracks afresh.
+	int detected = 0, followed = 0;
+	for (int i = 0; i < m_markers.size(); i++)
+	{
+		if (cornerTracked[i])
+		{
+			followed++;
+		}
+		else if (m_markers[i]->getError() >= 0)
+		{
+			m_cornerTrackAge[i] = 0;
+			detected++;
+		}
+	}
+	getTelemetry().count(TelemetryCounter::MARKERS_DETECTED, detected);
+	if (m_cornerTracking)
+	{
+		getTelemetry().count(TelemetryCounter::MARKERS_CORNER_TRACKED, followed);
+		getTelemetry().count(TelemetryCounter::CORNER_TRACKING_TIME, cornerTime);
+	}
+
+	// POSES OF THE BEST MATCHES
+	bool rigidBodySolved = m_rigidBodyPose && solveRigidBody();
+	for (int i = 0; i < m_markers.size(); i++)
+	{
+		if (m_markers[i]->getError() < 0 || (rigidBodySolved && m_markers[i]->hasOffset())) continue;
+
+		if (m_continuousPose)
+		{
+			// The state is still last frame's, so a valid marker has a transform to start from.
+			ARMarkerInfo* p_detection = &m_detections[i];
+			m_markers[i]->getARTransform(previousTransform);
+			solvePose([&](ARdouble(*p_seed)[4], ARdouble(*p_result)[4])
+			{
+				return (p_seed != NULL) ? arGetTransMatSquareCont(mp_ar3dHandle, p_detection, p_seed, 2.0, p_result)
+					: arGetTransMatSquare(mp_ar3dHandle, p_detection, 2.0, p_result);
+			}, m_markers[i]->isValid() ? previousTransform : NULL, transform);
+		}
+		else if (!fullSearch)
+		{
+			// Seeding with last frame's pose keeps the tracked pose from flipping.
+			m_markers[i]->getARTransform(previousTransform);
+			arGetTransMatSquareCont(mp_ar3dHandle, &m_detections[i], previousTransform, 2.0, transform);
+		}
+		else
+		{
+			arGetTransMatSquare(mp_ar3dHandle, &m_detections[i], 2.0, transform);
+		}
+		m_markers[i]->setARTransform(transform);
+	}
+
+
+	// UPDATE MARKER STATE
+	for (int i = 0; i < m_markers.size(); i++)
+	{
+		if (m_markers[i]->getError() >= 0)
+		{ 
+			switch (m_markers[i]->getState())
+			{
+			case MarkerState::LOST:
+			case MarkerState::UNREGISTERED:
+				m_markers[i]->setState(MarkerState::DETECTED);
+				break;
+			case MarkerState::DETECTED:
+				m_markers[i]->setState(MarkerState::TRACKING);
+				break;
+			}
+		}
+		else
+		{
+			switch (m_markers[i]->getState())
+			{
+			case MarkerState::DETECTED:
+			case MarkerState::TRACKING:
+				m_markers[i]->setState(MarkerState::LOST);
+				break;
+			case MarkerState::LOST:
+				m_markers[i]->setState(MarkerState::UNREGISTERED);
+			}
+		}
+
+		// PRINT OUT STUFF
+		if (m_verbose)
+		{ 
+			if (m_markers[i]->getState() == MarkerState::DETECTED)
+			{
+				std::cout << "Marker " << m_markers[i]->getMarkerID() << " detected." << endl;
+				std::cout << "CONFIDENCE: " << m_markers[i]->getError() << endl;
+			}
+			else if (m_markers[i]->getState() == MarkerState::LOST)
+			{
+				std::cout << "Marker " << m_markers[i]->getMarkerID() << " lost." << endl;
+			}
+		}
+	}
+
+	// This frame's pose decides what the results report as visible.
+	if (m_visibilityCulling)
+	{
+		updateVisibility();
+	}
+
+	publishSnapshot();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::runPasses(unsigned int first, unsigned int count, ubyte* p_frame, ubyte* p_coarseFrame)
+{
+	bool ownLabeling = (p_coarseFrame == NULL && p_frame == m_lumaPlane.getPixels());
+	if (ownLabeling && m_labelingMethod == LabelingMethod::COMPONENT_TREE)
+	{
+		labelComponentTree(first, count);
+		return;
+	}
+
+	bool banded = (ownLabeling && m_labelingMethod == LabelingMethod::ENGINE && m_passes[first].p_engine != nullptr);
+	bool tiled = (!banded && p_coarseFrame == NULL && !m_passes.empty() && m_passes[0].p_tiles != nullptr);
+	unsigned int tasksPerPass = banded ? m_passes[first].p_engine->getBandCount() : (tiled ? m_passes[0].p_tiles->getTileCount() : 1);
+	unsigned int taskCount = count * tasksPerPass;
+
+	std::function<void(unsigned int)> task = [&](unsigned int index)
+	{
+		DetectionPass &pass = m_passes[first + index / tasksPerPass];
+		if (banded)
+		{
+			pass.p_engine->labelBand(index % tasksPerPass, p_frame, pass.threshold);
+		}
+		else if (tiled)
+		{
+			pass.p_tiles->detectTile(index % tasksPerPass, p_frame, pass.threshold);
+		}
+		else
+		{
+			detectCandidates(pass, p_frame, p_coarseFrame);
+		}
+	};
+
+	if (mp_threadPool != nullptr && taskCount > 1)
+	{
+		mp_threadPool->run(taskCount, task);
+	}
+	else
+	{
+		for (unsigned int i = 0; i < taskCount; i++)
+		{
+			task(i);
+		}
+	}
+
+	if (tiled)
+	{
+		for (unsigned int i = first; i < first + count; i++)
+		{
+			m_passes[i].p_markerInfo = m_passes[i].p_tiles->mergeTiles(m_passes[i].markerNum);
+		}
+	}
+
+	if (banded)
+	{
+		ARParamLT* p_paramLT = mp_camera->getCameraParamLTPtr();
+		std::vector<ARMarkerInfo> candidates;
+		std::vector<unsigned int> passOf;
+
+		for (unsigned int i = first; i < first + count; i++)
+		{
+			m_passes[i].p_engine->mergeBands(m_passes[i].quads);
+			for (const ComponentQuad &quad : m_passes[i].quads)
+			{
+				ARMarkerInfo candidate;
+				if (quadToCandidate(quad, &p_paramLT->paramLTf, candidate))
+				{
+					candidates.push_back(candidate);
+					passOf.push_back(i);
+				}
+			}
+		}
+
+		std::vector<char> identified;
+		identifyQuads(candidates, identified);
+
+		for (unsigned int i = first; i < first + count; i++)
+		{
+			m_passes[i].candidates.clear();
+		}
+		for (unsigned int i = 0; i < candidates.size(); i++)
+		{
+			if (identified[i])
+			{
+				m_passes[passOf[i]].candidates.push_back(candidates[i]);
+			}
+		}
+		for (unsigned int i = first; i < first + count; i++)
+		{
+			m_passes[i].markerNum = (int)m_passes[i].candidates.size();
+			m_passes[i].p_markerInfo = m_passes[i].candidates.data();
+		}
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::labelComponentTree(unsigned int first, unsigned int count)
+{
+	ARParamLT* p_paramLT = mp_camera->getCameraParamLTPtr();
+
+	// The sweep needs ascending thresholds.
+	std::vector<unsigned int> passOrder(count);
+	for (unsigned int i = 0; i < count; i++)
+	{
+		passOrder[i] = first + i;
+	}
+	std::stable_sort(passOrder.begin(), passOrder.end(), [this](unsigned int a, unsigned int b) { return m_passes[a].threshold < m_passes[b].threshold; });
+
+	std::vector<int> thresholds(count);
+	for (unsigned int k = 0; k < count; k++)
+	{
+		thresholds[k] = m_passes[passOrder[k]].threshold;
+	}
+
+	m_componentTree.extract(m_lumaPlane.getPixels(), m_lumaPlane.getWidth(), m_lumaPlane.getHeight(), thresholds, m_componentQuads);
+
+	// DISTINCT QUADS: a component unchanged since the previous threshold shares its result.
+	std::vector<ARMarkerInfo> distinct;
+	std::vector<std::vector<int>> distinctOf(count);
+	for (unsigned int k = 0; k < count; k++)
+	{
+		for (const ComponentQuad &quad : m_componentQuads[k])
+		{
+			if (quad.previous >= 0)
+			{
+				distinctOf[k].push_back(distinctOf[k - 1][quad.previous]);
+				continue;
+			}
+
+			ARMarkerInfo candidate;
+			bool valid = quadToCandidate(quad, &p_paramLT->paramLTf, candidate);
+
+			distinctOf[k].push_back(valid ? (int)distinct.size() : -1);
+			if (valid)
+			{
+				distinct.push_back(candidate);
+			}
+		}
+	}
+
+	std::vector<char> identified;
+	identifyQuads(distinct, identified);
+
+	for (unsigned int k = 0; k < count; k++)
+	{
+		DetectionPass &pass = m_passes[passOrder[k]];
+		pass.candidates.clear();
+		for (int index : distinctOf[k])
+		{
+			if (index >= 0 && identified[index])
+			{
+				pass.candidates.push_back(distinct[index]);
+			}
+		}
+
+		pass.markerNum = (int)pass.candidates.size();
+		pass.p_markerInfo = pass.candidates.data();
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::identifyQuads(std::vector<ARMarkerInfo> &candidates, std::vector<char> &identified)
+{
+	ARParamLT* p_paramLT = mp_camera->getCameraParamLTPtr();
+	identified.assign(candidates.size(), 0);
+
+	// Quads run through the centres of the outermost dark pixels, half a pixel inside the edges.
+	// Squares no pattern matched are kept while matrix codes are loaded, for readMatrixCodes().
+	std::function<void(unsigned int)> task = [&](unsigned int index)
+	{
+		PatternHint hint;
+		refineCandidate(m_lumaPlane, &p_paramLT->paramLTf, candidates[index], 2.0f);
+		identified[index] = identifyCandidate(mp_arHandle, m_lumaPlane, p_paramLT, candidates[index], getPatternBank(),
+			hintCandidate(candidates[index], hint)) || !m_matrixCodeTypes.empty();
+	};
+
+	if (mp_threadPool != nullptr && candidates.size() > 1)
+	{
+		mp_threadPool->run((unsigned int)candidates.size(), task);
+	}
+	else
+	{
+		for (unsigned int i = 0; i < candidates.size(); i++)
+		{
+			task(i);
+		}
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::orderPasses()
+{
+	std::vector<unsigned int> steps(m_passes.size());
+	for (unsigned int i = 0; i < steps.size(); i++)
+	{
+		steps[i] = i;
+	}
+
+	if (m_earlyTermination)
+	{
+		std::stable_sort(steps.begin(), steps.end(), [this](unsigned int a, unsigned int b) { return m_passWins[a] > m_passWins[b]; });
+	}
+
+	for (unsigned int i = 0; i < m_passes.size(); i++)
+	{
+		m_passes[i].step = steps[i];
+		m_passes[i].threshold = getStepThreshold(steps[i]);
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::selectThresholds()
+{
+	m_autoThresholds.clear();
+	if (m_thresholdMode == ThresholdMode::MANUAL || !m_lumaValid)
+	{
+		return;
+	}
+
+	int width = (int)m_lumaPlane.getWidth();
+	int height = (int)m_lumaPlane.getHeight();
+	int left = 0, top = 0, right = width, bottom = height;
+
+	// The predicted squares, padded so the paper around each border is counted too.
+	if (m_thresholdRegionOnly)
+	{
+		ARParamLT* p_paramLT = mp_camera->getCameraParamLTPtr();
+		ARdouble prediction[3][4];
+		ARMarkerInfo projection;
+		bool anyPredicted = false;
+
+		for (int i = 0; i < m_markers.size(); i++)
+		{
+			if (!isSquare(m_markers[i]->getType()) || !m_markers[i]->isValid()
+				|| !m_markers[i]->predictARTransform(prediction, m_roiVelocity)
+				|| !projectCandidate(p_paramLT->param, prediction, 2.0, projection))
+			{
+				continue;
+			}
+
+			ARdouble minX = projection.vertex[0][0], maxX = minX, minY = projection.vertex[0][1], maxY = minY;
+			for (int j = 1; j < 4; j++)
+			{
+				minX = std::min(minX, projection.vertex[j][0]);
+				maxX = std::max(maxX, projection.vertex[j][0]);
+				minY = std::min(minY, projection.vertex[j][1]);
+				maxY = std::max(maxY, projection.vertex[j][1]);
+			}
+			ARdouble padding = std::max(maxX - minX, maxY - minY) / 2.0;
+
+			int regionLeft = (int)(minX - padding), regionTop = (int)(minY - padding);
+			int regionRight = (int)(maxX + padding) + 1, regionBottom = (int)(maxY + padding) + 1;
+			left = anyPredicted ? std::min(left, regionLeft) : regionLeft;
+			top = anyPredicted ? std::min(top, regionTop) : regionTop;
+			right = anyPredicted ? std::max(right, regionRight) : regionRight;
+			bottom = anyPredicted ? std::max(bottom, regionBottom) : regionBottom;
+			anyPredicted = true;
+		}
+
+		if (!anyPredicted)
+		{
+			left = top = 0;
+			right = width;
+			bottom = height;
+		}
+	}
+
+	// Every other row is plenty for a histogram and halves its cost.
+	m_histogram.build(m_lumaPlane.getPixels(), width, height, left, top, right - left, bottom - top, 2);
+
+	int low, high;
+	switch (m_thresholdMode)
+	{
+	case ThresholdMode::OTSU:
+		low = m_histogram.otsu();
+		if (low >= 0) m_autoThresholds.push_back(low);
+		break;
+	case ThresholdMode::MULTI_OTSU:
+		if (m_histogram.multiOtsu(low, high))
+		{
+			m_autoThresholds.push_back(low);
+			m_autoThresholds.push_back(high);
+		}
+		break;
+	case ThresholdMode::PERCENTILE:
+		low = m_histogram.percentile(m_thresholdPercentile);
+		high = m_histogram.percentile(1.0f - m_thresholdPercentile);
+		if (low >= 0) m_autoThresholds.push_back((low + high) / 2);
+		break;
+	case ThresholdMode::MANUAL:
+		break;
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+int ARManager::getStepThreshold(unsigned int step) const
+{
+	int threshold;
+	if (m_autoThresholds.empty())
+	{
+		threshold = m_baseThreshold + (int)step * m_passIncrement;
+	}
+	else if (step < m_autoThresholds.size())
+	{
+		threshold = m_autoThresholds[step];
+	}
+	else
+	{
+		threshold = m_autoThresholds.back() + (int)(step - m_autoThresholds.size() + 1) * m_passIncrement;
+	}
+
+	return (threshold < 0) ? 0 : ((threshold > 255) ? 255 : threshold);
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::detectCandidates(DetectionPass &pass, ubyte* p_frame, ubyte* p_coarseFrame)
+{
+	ARMarkerInfo* p_markerInfo;
+
+	if (p_coarseFrame == NULL)
+	{
+		arSetLabelingThresh(pass.p_handle, pass.threshold);
+		arDetectMarker(pass.p_handle, p_frame);
+		pass.markerNum = arGetMarkerNum(pass.p_handle);
+		pass.p_markerInfo = arGetMarker(pass.p_handle);
+		return;
+	}
+
+	pass.markerNum = 0;
+	pass.p_markerInfo = NULL;
+	arSetLabelingThresh(pass.p_coarseHandle, pass.threshold);
+	if (arDetectMarker(pass.p_coarseHandle, p_coarseFrame) < 0 || (p_markerInfo = arGetMarker(pass.p_coarseHandle)) == NULL)
+	{
+		return;
+	}
+
+	// Coarse corners are off by up to a coarse pixel, which the edge search has to cover.
+	ARdouble scale = (ARdouble)(1 << m_pyramidLevel);
+	float searchRadius = 2.0f * (float)scale;
+	ARParamLT* p_paramLT = mp_camera->getCameraParamLTPtr();
+
+	int candidateNum = arGetMarkerNum(pass.p_coarseHandle);
+	PatternHint hint;
+
+	pass.candidates.clear();
+	for (int i = 0; i < candidateNum; i++)
+	{
+		ARMarkerInfo candidate = p_markerInfo[i];
+		scaleCandidate(candidate, scale);
+
+		// Unrefined corners are still good enough to identify the pattern.
+		refineCandidate(m_lumaPlane, &p_paramLT->paramLTf, candidate, searchRadius);
+		if (identifyCandidate(pass.p_handle, m_lumaPlane, p_paramLT, candidate, getPatternBank(), hintCandidate(candidate, hint))
+			|| !m_matrixCodeTypes.empty())
+		{
+			pass.candidates.push_back(candidate);
+		}
+	}
+
+	pass.markerNum = (int)pass.candidates.size();
+	pass.p_markerInfo = pass.candidates.data();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::applyDetections(ARMarkerInfo* p_markerInfo, int markerNum, int step)
+{
+	int bestMatch, bestDir, dir;
+	ARdouble cf;
+
+	if (!m_matrixCodeTypes.empty())
+	{
+		readMatrixCodes(p_markerInfo, markerNum);
+	}
+
+	// MATCH MARKERS TO RESULTS AND PICK BEST ONE
+	for (int i = 0; i < m_markers.size(); i++)
+	{
+		if (!isSquare(m_markers[i]->getType()) || isCulled(i, BACK_FACE_LIMIT)) continue; // A face turned away is a misidentification
+		bestMatch = -1;
+		bestDir = 0;
+
+		for (int j = 0; j < markerNum; j++)
+		{
+			if (matchDetection(i, p_markerInfo[j], dir, cf))
+			{
+				if (m_markers[i]->getError() < cf)
+				{
+					m_markers[i]->setError(cf);
+					bestMatch = j;
+					bestDir = dir;
+				}
+			}
+		} // END j loop
+
+		if (bestMatch != -1) // Suitible Match found
+		{
+			m_detections[i] = p_markerInfo[bestMatch];
+			m_detections[i].dir = bestDir;
+			m_detections[i].cf = m_markers[i]->getError();
+			m_detectionSteps[i] = step;
+			if (m_markers[i]->getType() == MarkerType::MATRIX_CODE)
+			{
+				m_detections[i].id = m_detections[i].idPatt = -1; // Whatever glyph the square resembled
+			}
+		}
+	}// END i loop
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::readMatrixCodes(ARMarkerInfo* p_markerInfo, int markerNum)
+{
+	ARParamLT* p_paramLT = mp_camera->getCameraParamLTPtr();
+	int id, dir;
+	ARdouble cf;
+
+	for (int j = 0; j < markerNum; j++)
+	{
+		ARMarkerInfo &info = p_markerInfo[j];
+		info.idMatrix = -1;
+		info.cfMatrix = -1;
+		if ((info.id >= 0 && info.cf > m_errorTolerance) || !m_lumaValid) continue; // A glyph
+
+		for (MatrixCodeType type : m_matrixCodeTypes)
+		{
+			if (!readMatrixCode(m_lumaPlane.getPixels(), (int)m_lumaPlane.getWidth(), (int)m_lumaPlane.getHeight(), &p_paramLT->paramLTf,
+				mp_arHandle->arImageProcMode, info.vertex, mp_arHandle->pattRatio, type, id, dir, cf) || cf <= info.cfMatrix)
+			{
+				continue;
+			}
+
+			for (int i = 0; i < m_markers.size(); i++)
+			{
+				if (m_markers[i]->getType() == MarkerType::MATRIX_CODE && ((MatrixCodeMarker*)m_markers[i])->getCodeType() == type
+					&& ((MatrixCodeMarker*)m_markers[i])->getBarcodeID() == id)
+				{
+					info.idMatrix = i;
+					info.dirMatrix = dir;
+					info.cfMatrix = cf;
+					break;
+				}
+			}
+		}
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool ARManager::matchDetection(int index, const ARMarkerInfo &detection, int &dir, ARdouble &cf)
+{
+	switch (m_markers[index]->getType())
+	{
+	case MarkerType::GLYPH:
+		dir = detection.dir;
+		cf = detection.cf;
+		return detection.id == ((GlyphMarker*)m_markers[index])->getARPatternID() && cf > m_errorTolerance;
+	case MarkerType::MATRIX_CODE:
+		dir = detection.dirMatrix;
+		cf = detection.cfMatrix;
+		return detection.idMatrix == index && cf > m_errorTolerance;
+	default:
+		return false;
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool ARManager::solveRigidBody()
+{
+	const ARdouble width = 2.0; // Marker width, as for the faces' own poses
+	static const ARdouble CORNERS[4][2] = { { -1, 1 }, { 1, 1 }, { 1, -1 }, { -1, -1 } }; // Times width / 2, in arGetTransMatSquare()'s order
+
+	std::vector<ARdouble> screen, body;
+	int bestFace = -1;
+
+	// EVERY DETECTED FACE'S CORNERS, in body coordinates
+	for (int i = 0; i < m_markers.size(); i++)
+	{
+		if (m_markers[i]->getError() < 0 || !m_markers[i]->hasOffset()) continue;
+
+		if (bestFace < 0 || m_markers[i]->getError() > m_markers[bestFace]->getError())
+		{
+			bestFace = i;
+		}
+
+		// Camera from face = camera from body * offset^-1, so a face point p is offset^-1 * p on the body.
+		ARPose faceToBody = glm::inverse(m_markers[i]->getOffset());
+		const ARMarkerInfo &detection = m_detections[i];
+		for (int j = 0; j < 4; j++)
+		{
+			int vertex = (4 - detection.dir + j) % 4;
+			screen.push_back(detection.vertex[vertex][0]);
+			screen.push_back(detection.vertex[vertex][1]);
+
+			glm::dvec4 point = faceToBody * glm::dvec4(CORNERS[j][0] * width / 2, CORNERS[j][1] * width / 2, 0.0, 1.0);
+			body.push_back(point.x);
+			body.push_back(point.y);
+			body.push_back(point.z);
+		}
+	}
+
+	if (bestFace < 0)
+	{
+		m_rigidBodyValid = false;
+		return false;
+	}
+
+	// INITIAL POSE
+	ARdouble initial[3][4], offset[3][4], faceTransform[3][4];
+	if (m_rigidBodyValid)
+	{
+		std::copy(&m_rigidBodyTransform[0][0], &m_rigidBodyTransform[0][0] + 12, &initial[0][0]);
+	}
+	else
+	{
+		arGetTransMatSquare(mp_ar3dHandle, &m_detections[bestFace], width, faceTransform);
+
+		ARPose pose = m_markers[bestFace]->getOffset();
+		for (int r = 0; r < 3; r++)
+		{
+			for (int c = 0; c < 4; c++)
+			{
+				offset[r][c] = pose[c][r];
+			}
+		}
+		arUtilMatMul(faceTransform, offset, initial);
+	}
+
+	// ONE SOLVE FOR EVERY CORNER
+	// The error is the mean squared reprojection error; a failed or diverged solve comes back huge.
+	int pointCount = (int)screen.size() / 2;
+	PoseStep step = [&](ARdouble(*p_seed)[4], ARdouble(*p_result)[4])
+	{
+		return arGetTransMat(mp_ar3dHandle, p_seed, (ARdouble(*)[2])screen.data(), (ARdouble(*)[3])body.data(), pointCount, p_result);
+	};
+	ARdouble error = (m_continuousPose && m_rigidBodyValid) ? solvePose(step, initial, m_rigidBodyTransform)
+		: step(initial, m_rigidBodyTransform);
+	if (error < 0 || error > MAX_RIGID_BODY_ERROR)
+	{
+		m_rigidBodyValid = false;
+		return false;
+	}
+	m_rigidBodyValid = true;
+
+	// FACES FOLLOW THE BODY
+	for (int i = 0; i < m_markers.size(); i++)
+	{
+		if (m_markers[i]->getError() < 0 || !m_markers[i]->hasOffset()) continue;
+
+		ARPose inverse = glm::inverse(m_markers[i]->getOffset());
+		for (int r = 0; r < 3; r++)
+		{
+			for (int c = 0; c < 4; c++)
+			{
+				offset[r][c] = inverse[c][r];
+			}
+		}
+		arUtilMatMul(m_rigidBodyTransform, offset, faceTransform);
+		m_markers[i]->setARTransform(faceTransform);
+	}
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+ARdouble ARManager::solvePose(const PoseStep &step, ARdouble(*p_seed)[4], ARdouble result[3][4])
+{
+	// One ICP iteration per step, so iterations can be counted and the cap chosen from the residual.
+	ICPHandleT* p_icpHandle = mp_ar3dHandle->icpHandle;
+	int defaultLoops;
+	ARdouble defaultTarget;
+	icpGetMaxLoop(p_icpHandle, &defaultLoops);
+	icpGetBreakLoopErrorThresh(p_icpHandle, &defaultTarget);
+	icpSetMaxLoop(p_icpHandle, 1);
+	icpSetBreakLoopErrorThresh(p_icpHandle, m_poseResidualTarget);
+
+	ARdouble current[3][4], next[3][4];
+	ARdouble residual = step(p_seed, current);
+	int iterations = 1;
+
+	// A seeded solve that lands near the target is a held marker; one more step is all it can use.
+	int maxIterations = m_poseMaxIterations;
+	if (p_seed != NULL && residual <= m_poseResidualTarget * SETTLED_RESIDUAL_FACTOR)
+	{
+		maxIterations = std::min(maxIterations, SETTLED_MAX_ITERATIONS);
+	}
+
+	while (iterations < maxIterations && residual > m_poseResidualTarget)
+	{
+		ARdouble nextResidual = step(current, next);
+		iterations++;
+
+		if (nextResidual < residual)
+		{
+			std::copy(&next[0][0], &next[0][0] + 12, &current[0][0]);
+		}
+		if (nextResidual >= residual * 0.99) // Converged or diverging
+		{
+			residual = std::min(residual, nextResidual);
+			break;
+		}
+		residual = nextResidual;
+	}
+
+	icpSetMaxLoop(p_icpHandle, defaultLoops);
+	icpSetBreakLoopErrorThresh(p_icpHandle, defaultTarget);
+	std::copy(&current[0][0], &current[0][0] + 12, &result[0][0]);
+
+	Telemetry &telemetry = getTelemetry();
+	telemetry.count(TelemetryCounter::POSE_SOLVES);
+	telemetry.count(TelemetryCounter::POSE_ITERATIONS, iterations);
+	telemetry.count(TelemetryCounter::POSE_RESIDUAL, (unsigned long long)(residual * 1000.0));
+	if (p_seed != NULL)
+	{
+		telemetry.count(TelemetryCounter::SEEDED_POSE_SOLVES);
+	}
+	if (maxIterations < m_poseMaxIterations)
+	{
+		telemetry.count(TelemetryCounter::SETTLED_POSE_SOLVES);
+	}
+
+	return residual;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool ARManager::trackMarker(int index, ARMarkerInfo &detection)
+{
+	ARdouble prediction[3][4];
+	ARParamLT* p_paramLT = mp_camera->getCameraParamLTPtr();
+
+	int dir;
+	ARdouble cf;
+
+	if (!isSquare(m_markers[index]->getType()) || !m_markers[index]->predictARTransform(prediction, m_roiVelocity))
+	{
+		return false;
+	}
+
+	// The marker's square is searched for only within m_roiPadding pixels of where it is expected.
+	if (!projectCandidate(p_paramLT->param, prediction, 2.0, detection)
+		|| !refineCandidate(m_lumaPlane, &p_paramLT->paramLTf, detection, m_roiPadding))
+	{
+		return false;
+	}
+
+	if (m_markers[index]->getType() == MarkerType::GLYPH)
+	{
+		// The projected square starts at the pattern's first corner, so only rotation 0 is expected.
+		PatternHint hint;
+		hint.codes.push_back(((GlyphMarker*)m_markers[index])->getARPatternID() * 4);
+		hint.minConfidence = m_errorTolerance;
+
+		if (!identifyCandidate(mp_arHandle, m_lumaPlane, p_paramLT, detection, getPatternBank(), m_patternHints ? &hint : nullptr))
+		{
+			return false;
+		}
+	}
+	else
+	{
+		// The square carries last frame's detection; its glyph result would have it skipped as a glyph.
+		detection.id = detection.idPatt = -1;
+		detection.cf = detection.cfPatt = 0;
+		readMatrixCodes(&detection, 1);
+	}
+
+	if (!matchDetection(index, detection, dir, cf))
+	{
+		return false;
+	}
+	detection.dir = dir;
+	detection.cf = cf;
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool ARManager::trackCorners(int index, ARMarkerInfo &detection)
+{
+	if (!isSquare(m_markers[index]->getType()) || m_markers[index]->getState() != MarkerState::TRACKING
+		|| !m_cornerTracker.hasPrevious())
+	{
+		return false;
+	}
+
+	// Flow is measured in the plane, where corners are observed; detections are ideal.
+	ARParamLTf* p_paramLTf = &mp_camera->getCameraParamLTPtr()->paramLTf;
+	ARdouble vertex[4][2];
+	for (int i = 0; i < 4; i++)
+	{
+		float from[2], to[2], ix, iy, residual;
+		if (arParamIdeal2ObservLTf(p_paramLTf, (float)detection.vertex[i][0], (float)detection.vertex[i][1], &from[0], &from[1]) < 0
+			|| !m_cornerTracker.track(from, to, residual) || residual > m_maxCornerResidual
+			|| arParamObserv2IdealLTf(p_paramLTf, to[0], to[1], &ix, &iy) < 0)
+		{
+			return false;
+		}
+		vertex[i][0] = ix;
+		vertex[i][1] = iy;
+	}
+
+	detection.pos[0] = detection.pos[1] = 0;
+	for (int i = 0; i < 4; i++)
+	{
+		detection.vertex[i][0] = vertex[i][0];
+		detection.vertex[i][1] = vertex[i][1];
+		detection.pos[0] += vertex[i][0] / 4;
+		detection.pos[1] += vertex[i][1] / 4;
+	}
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::updateVisibility()
+{
+	ARdouble faceTransform[3][4], offset[3][4];
+	int bestFace = -1;
+
+	m_visibilityKnown = false;
+	if (m_culler.getFaceCount() == 0)
+	{
+		return;
+	}
+
+	if (m_rigidBodyPose && m_rigidBodyValid)
+	{
+		std::copy(&m_rigidBodyTransform[0][0], &m_rigidBodyTransform[0][0] + 12, &m_bodyTransform[0][0]);
+	}
+	else
+	{
+		for (int i = 0; i < m_markers.size(); i++)
+		{
+			if (m_cullerFaces[i] >= 0 && m_markers[i]->isValid()
+				&& (bestFace < 0 || m_markers[i]->getError() > m_markers[bestFace]->getError()))
+			{
+				bestFace = i;
+			}
+		}
+		if (bestFace < 0)
+		{
+			return;
+		}
+
+		ARPose pose = m_markers[bestFace]->getOffset();
+		for (int r = 0; r < 3; r++)
+		{
+			for (int c = 0; c < 4; c++)
+			{
+				offset[r][c] = pose[c][r];
+			}
+		}
+		m_markers[bestFace]->getARTransform(faceTransform);
+		arUtilMatMul(faceTransform, offset, m_bodyTransform);
+	}
+
+	m_culler.cull(m_bodyTransform, mp_camera->getCameraParamLTPtr()->param, m_facing, m_inFrame);
+	m_visibilityKnown = true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool ARManager::isCulled(int index, float cutoff) const
+{
+	if (!m_visibilityCulling || !m_visibilityKnown || index >= m_cullerFaces.size() || m_cullerFaces[index] < 0)
+	{
+		return false;
+	}
+
+	int face = m_cullerFaces[index];
+	return m_facing[face] <= cutoff || !m_inFrame[face];
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::predictPatterns()
+{
+	ARParamLT* p_paramLT = mp_camera->getCameraParamLTPtr();
+	ARdouble transform[3][4], offset[3][4];
+	ARMarkerInfo projection;
+
+	for (int i = 0; i < m_markers.size(); i++)
+	{
+		if (m_markers[i]->getType() != MarkerType::GLYPH) continue;
+
+		if (!m_markers[i]->predictARTransform(transform, m_roiVelocity))
+		{
+			int face = (i < m_cullerFaces.size()) ? m_cullerFaces[i] : -1;
+			if (!m_visibilityKnown || face < 0 || m_facing[face] <= BACK_FACE_LIMIT || !m_inFrame[face]) continue;
+
+			// Camera from face = camera from body * offset^-1
+			ARPose inverse = glm::inverse(m_markers[i]->getOffset());
+			for (int r = 0; r < 3; r++)
+			{
+				for (int c = 0; c < 4; c++)
+				{
+					offset[r][c] = inverse[c][r];
+				}
+			}
+			arUtilMatMul(m_bodyTransform, offset, transform);
+		}
+
+		if (!projectCandidate(p_paramLT->param, transform, 2.0, projection)) continue;
+
+		ExpectedPattern expected;
+		expected.patternID = ((GlyphMarker*)m_markers[i])->getARPatternID();
+		expected.pos[0] = projection.pos[0];
+		expected.pos[1] = projection.pos[1];
+		expected.radius = 0;
+		for (int j = 0; j < 4; j++)
+		{
+			expected.vertex[j][0] = projection.vertex[j][0];
+			expected.vertex[j][1] = projection.vertex[j][1];
+			expected.radius = std::max(expected.radius, hypot(expected.vertex[j][0] - expected.pos[0], expected.vertex[j][1] - expected.pos[1]));
+		}
+		m_expectedPatterns.push_back(expected);
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+const PatternHint* ARManager::hintCandidate(const ARMarkerInfo &candidate, PatternHint &hint) const
+{
+	hint.codes.clear();
+	hint.minConfidence = m_errorTolerance;
+
+	for (const ExpectedPattern &expected : m_expectedPatterns)
+	{
+		if (hypot(candidate.pos[0] - expected.pos[0], candidate.pos[1] - expected.pos[1]) > expected.radius) continue;
+
+		// With rotation dir, the candidate's corner (4 - dir + j) % 4 is the pattern's corner j.
+		int bestDir = 0;
+		ARdouble bestDistance = -1;
+		for (int dir = 0; dir < 4; dir++)
+		{
+			ARdouble distance = 0;
+			for (int j = 0; j < 4; j++)
+			{
+				const ARdouble* p_vertex = candidate.vertex[(4 - dir + j) % 4];
+				distance += (p_vertex[0] - expected.vertex[j][0]) * (p_vertex[0] - expected.vertex[j][0])
+					+ (p_vertex[1] - expected.vertex[j][1]) * (p_vertex[1] - expected.vertex[j][1]);
+			}
+			if (bestDistance < 0 || distance < bestDistance)
+			{
+				bestDistance = distance;
+				bestDir = dir;
+			}
+		}
+		hint.codes.push_back(expected.patternID * 4 + bestDir);
+	}
+
+	return hint.codes.empty() ? nullptr : &hint;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+float ARManager::getMarkerError(int markerID) const
+{
+	TrackingSnapshotReader snapshot(m_snapshots);
+	return snapshot->getError(markerID);
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::publishSnapshot()
+{
+	TrackingSnapshot& snapshot = m_snapshots.beginWrite();
+	bool reindex = (snapshot.markers.size() != m_markers.size());
+
+	snapshot.frameSequence = m_frameSequence;
+	snapshot.markers.resize(m_markers.size());
+	for (int i = 0; i < m_markers.size(); i++)
+	{
+		MarkerResult& result = snapshot.markers[i];
+		reindex = reindex || result.markerID != m_markers[i]->getMarkerID();
+
+		result.markerID = m_markers[i]->getMarkerID();
+		result.state = m_markers[i]->getState();
+		result.error = m_markers[i]->isValid() ? m_markers[i]->getError() : -1;
+		result.pose = m_markers[i]->getPose();
+		result.offsetPose = m_markers[i]->getOffsetPose();
+		result.visible = !isCulled(i, m_visibilityCutoff);
+		result.visibilityKnown = m_visibilityCulling && m_visibilityKnown && i < m_cullerFaces.size() && m_cullerFaces[i] >= 0;
+	}
+
+	if (reindex)
+	{
+		snapshot.buildIndex();
+	}
+
+	m_snapshots.publish();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+ARPose ARManager::getMarkerPose(int markerID) const
+{
+	TrackingSnapshotReader snapshot(m_snapshots);
+	return snapshot->getPose(markerID);
+}
+
+
+ARPose ARManager::getMarkerPose(const std::string &markerName) const
+{
+	for (int i = 0; i < m_markers.size(); i++)
+	{
+		if (m_markers[i]->getName() == markerName)
+		{
+			return getMarkerPose(m_markers[i]->getMarkerID());
+		}
+	}
+
+	return ZERO_MATRIX_4X4;
+}
+
+
+//---------------------------------------------------------------------------------//
+
+
+ARPose ARManager::getOffsetMarkerPose(int markerID) const
+{
+	TrackingSnapshotReader snapshot(m_snapshots);
+	return snapshot->getOffsetPose(markerID);
+}
+
+
+ARPose ARManager::getOffsetMarkerPose(const std::string &markerName) const
+{
+	for (int i = 0; i < m_markers.size(); i++)
+	{
+		if (m_markers[i]->getName() == markerName)
+		{
+			return getOffsetMarkerPose(m_markers[i]->getMarkerID());
+		}
+	}
+
+	return ZERO_MATRIX_4X4;
+}
+
+
+//---------------------------------------------------------------------------------//
+
+
+ARPose ARManager::getMarkerOffset(int markerNumber) const
+{
+	for (int i = 0; i < m_markers.size(); i++)
+	{
+		if (m_markers[i]->getMarkerID() == markerNumber)
+		{
+			return m_markers[i]->getOffset();
+		}
+	}
+
+	return ZERO_MATRIX_4X4;
+}
+
+
+ARPose ARManager::getMarkerOffset(const std::string &markerName) const
+{
+	for (int i = 0; i < m_markers.size(); i++)
+	{
+		if (m_markers[i]->getName() == markerName)
+		{
+			return m_markers[i]->getOffset();
+		}
+	}
+
+	return ZERO_MATRIX_4X4;
+}
+
+
+//---------------------------------------------------------------------------------//
+
+
+int ARManager::getMarkerPageNumber(std::string &markerName) const
+{
+	for (int i = 0; i < m_markers.size(); i++)
+	{
+		if (markerName == m_markers[i]->getName())
+		{
+			return m_markers[i]->getMarkerID();
+		}
+	}
+
+	return -1;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::setBaseThreshold(unsigned int threshold)
+{
+	if (threshold < 0)
+	{
+		m_baseThreshold = 0;
+	}
+	else if (threshold > 255)
+	{
+		m_baseThreshold = 255;
+	}
+	else
+	{
+		m_baseThreshold = threshold;
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::setHalfResolutionLuma(bool enabled)
+{
+	m_lumaPlane.resize(m_lumaPlane.getWidth(), m_lumaPlane.getHeight(), enabled);
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::setPyramidLevel(int level)
+{
+	m_pyramidLevel = (level < 0) ? 0 : ((level > 2) ? 2 : level);
+
+	if (m_pyramidLevel > 0)
+	{
+		setHalfResolutionLuma(true); // Every level is built from the half resolution plane.
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool ARManager::initPyramid()
+{
+	freePyramid();
+
+	if (mp_arHandle == nullptr)
+	{
+		return false;
+	}
+
+	ARParamLT* p_paramLT = mp_camera->getCameraParamLTPtr();
+	int width = m_lumaPlane.getHalfWidth();
+	int height = m_lumaPlane.getHalfHeight();
+	if (m_pyramidLevel == 2)
+	{
+		width /= 2;
+		height /= 2;
+		m_quarterPixels.resize(width * height);
+	}
+
+	ARParam coarseParam;
+	bool created = arParamChangeSize(&p_paramLT->param, width, height, &coarseParam) >= 0
+		&& (mp_coarseParamLT = arParamLTCreate(&coarseParam, AR_PARAM_LT_DEFAULT_OFFSET)) != NULL;
+
+	// Same patterns and settings as the full-resolution handle, but always luma.
+	for (int i = 0; created && i < m_passes.size(); i++)
+	{
+		created = (m_passes[i].p_coarseHandle = createDetectionHandle(mp_arHandle, mp_coarseParamLT)) != NULL;
+		if (created)
+		{
+			arSetPixelFormat(m_passes[i].p_coarseHandle, AR_PIXEL_FORMAT_MONO);
+			arSetPatternDetectionMode(m_passes[i].p_coarseHandle, AR_TEMPLATE_MATCHING_MONO);
+		}
+	}
+
+	if (!created)
+	{
+		std::cout << "Pyramid detection could not be initialized; detecting on the full frame." << std::endl;
+		freePyramid();
+		m_pyramidLevel = 0;
+		return false;
+	}
+
+	m_coarseLevel = m_pyramidLevel;
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::freePyramid()
+{
+	for (int i = 0; i < m_passes.size(); i++)
+	{
+		deleteDetectionHandle(m_passes[i].p_coarseHandle);
+	}
+
+	if (mp_coarseParamLT != nullptr)
+	{
+		arParamLTFree(&mp_coarseParamLT);
+	}
+
+	m_coarseLevel = 0;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::setPatternBank(bool enabled)
+{
+	m_patternBankEnabled = enabled;
+	if (!enabled)
+	{
+		m_patternBank.clear();
+	}
+	else if (mp_arHandle != nullptr && !m_patternBank.build(mp_arHandle->pattHandle) && !m_markers.empty())
+	{
+		std::cout << "WARNING: No patterns for the pattern bank; using ARToolKit's matching." << std::endl;
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::setCornerTracking(bool enabled, unsigned int reidentifyInterval, float maxResidual)
+{
+	m_cornerTracking = enabled;
+	m_reidentifyInterval = (reidentifyInterval < 1) ? 1 : reidentifyInterval;
+	m_maxCornerResidual = maxResidual;
+	m_cornerTracker.reset();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::setContinuousPose(bool enabled, int maxIterations, float residualTarget)
+{
+	m_continuousPose = enabled;
+	m_poseMaxIterations = (maxIterations < 1) ? 1 : maxIterations;
+	m_poseResidualTarget = (residualTarget < 0.0f) ? 0.0 : residualTarget;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::setTiledDetection(unsigned int rows, unsigned int columns, int overlap)
+{
+	m_tileRows = (rows < 1) ? 1 : rows;
+	m_tileColumns = (columns < 1) ? 1 : columns;
+	m_tileOverlap = (overlap < 0) ? 0 : overlap;
+
+	freeTiling(); // Recreated for the new layout when next needed.
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool ARManager::initTiling()
+{
+	freeTiling();
+
+	if (mp_arHandle == nullptr)
+	{
+		return false;
+	}
+
+	for (int i = 0; i < m_passes.size(); i++)
+	{
+		m_passes[i].p_tiles = new TiledDetector();
+		if (!m_passes[i].p_tiles->init(m_passes[i].p_handle, m_tileRows, m_tileColumns, m_tileOverlap))
+		{
+			freeTiling();
+			m_tileRows = m_tileColumns = 1;
+			return false;
+		}
+	}
+
+	if (mp_threadPool == nullptr)
+	{
+		mp_threadPool = new ThreadPool(m_detectionThreads);
+	}
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::freeTiling()
+{
+	for (int i = 0; i < m_passes.size(); i++)
+	{
+		delete m_passes[i].p_tiles;
+		m_passes[i].p_tiles = nullptr;
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool ARManager::initEngines()
+{
+	freeEngines();
+
+	if (mp_threadPool == nullptr)
+	{
+		mp_threadPool = new ThreadPool(m_detectionThreads);
+	}
+
+	// Bands of fewer rows would spend more on joining than they save.
+	int height = (int)m_lumaPlane.getHeight();
+	unsigned int bandCount = std::max(1u, std::min(2 * mp_threadPool->getThreadCount(), (unsigned int)(height / 32)));
+
+	for (int i = 0; i < m_passes.size(); i++)
+	{
+		m_passes[i].p_engine = new LabelingEngine();
+		if (!m_passes[i].p_engine->init((int)m_lumaPlane.getWidth(), height, bandCount))
+		{
+			freeEngines();
+			m_labelingMethod = LabelingMethod::ARTOOLKIT;
+			return false;
+		}
+	}
+
+	return !m_passes.empty();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::freeEngines()
+{
+	for (int i = 0; i < m_passes.size(); i++)
+	{
+		delete m_passes[i].p_engine;
+		m_passes[i].p_engine = nullptr;
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool ARManager::initPasses()
+{
+	freePasses();
+
+	if (mp_arHandle == nullptr)
+	{
+		return false;
+	}
+
+	for (unsigned int i = 0; i < m_numberOfPasses; i++)
+	{
+		DetectionPass pass;
+		pass.step = i;
+		pass.threshold = m_baseThreshold + (int)i * m_passIncrement;
+		pass.p_handle = (i == 0) ? mp_arHandle : createDetectionHandle(mp_arHandle, mp_camera->getCameraParamLTPtr());
+		pass.p_coarseHandle = nullptr;
+		pass.p_tiles = nullptr;
+		pass.p_engine = nullptr;
+		pass.p_markerInfo = NULL;
+		pass.markerNum = 0;
+
+		if (pass.p_handle == NULL)
+		{
+			std::cout << "Only " << i << " of " << m_numberOfPasses << " detection passes could be created." << std::endl;
+			m_numberOfPasses = i;
+			break;
+		}
+		m_passes.push_back(pass);
+	}
+	m_passWins.assign(m_passes.size(), 0); // A new set of thresholds starts without history.
+
+	if (m_passes.size() > 1 && mp_threadPool == nullptr)
+	{
+		mp_threadPool = new ThreadPool(m_detectionThreads);
+	}
+
+	return m_passes.size() == m_numberOfPasses;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::freePasses()
+{
+	freePyramid();
+	freeTiling();
+	freeEngines();
+
+	for (int i = 0; i < m_passes.size(); i++)
+	{
+		if (m_passes[i].p_handle != mp_arHandle)
+		{
+			deleteDetectionHandle(m_passes[i].p_handle);
+		}
+	}
+	m_passes.clear();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool ARManager::start()
+{
+	if (!mp_camera->startCamera())
+	{
+		return false;
+	}
+
+	if (m_threadedCapture && !m_capturing)
+	{
+		if (mp_frameRing == nullptr)
+		{
+			mp_frameRing = new FrameRing(*mp_framePool);
+			mp_cameraFrame = mp_frameRing->getReadBuffer();
+		}
+
+		m_capturing = true;
+		m_captureThread = std::thread(&ARManager::captureLoop, this);
+	}
+
+	m_running = true;
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::stop()
+{
+	stopCaptureThread();
+	mp_camera->stopCamera();
+	m_running = false;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::captureLoop()
+{
+	while (m_capturing)
+	{
+		if (mp_camera->tryGetCameraFrame(*mp_frameRing->getWriteBuffer()))
+		{
+			mp_frameRing->publish(mp_camera->getFrameSequence(), mp_camera->getFrameTimestamp());
+		}
+		else
+		{
+			mp_camera->getFrameSourcePtr()->waitForFrame(10); // Camera has nothing new yet
+		}
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARManager::stopCaptureThread()
+{
+	m_capturing = false;
+
+	if (m_captureThread.joinable())
+	{
+		m_captureThread.join();
+	}
 }
\ No newline at end of file
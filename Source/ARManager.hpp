@@ -1,124 +1,620 @@
-//================================================================================//
-// ARManager
-//	- Manager class for ARMarkers
-//--------------------------------------------------------------------------------//
-// AUTHOR: Glen Straughn
-// DATE: 01.16.2018
-// COMPILER: Microsoft Visual C++
-//--------------------------------------------------------------------------------//
-// NOTE: This class currently only supports glyph markers, because I have no reason
-//		 to incorporate NFT functionality.
-//================================================================================//
-#pragma once
-
-#include<AR/ar.h>
-
-#include<vector>
-#include<string>
-
-#include "ARMarker.hpp"
-#include "GlyphMarker.hpp"
-#include "ARCamera.hpp"
-#include "TypeDef.hpp"
-
-class ARManager
-{
-public:
-	ARManager();
-
-	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-	// DESCRIPTION: Initialize camera and load parameters.
-	// MUTATES:
-	//	- mp_camera: Instantiates and initializes.
-	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-	bool initCamera(const std::string &cameraParameterFilePath);
-
-	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-	// DESCRIPTION: Initialize NFTManager.
-	// MUTATES:
-	//	- mp_cameraFrame: Instantiates.
-	//	- m_AR2Handle: Instantiates.
-	// NOTES: Must be called after initCamera
-	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-	bool initManager();
-
-	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-	// DESCRIPTION: Load markers and configurations from file.
-	// MUTATES:
-	//	- m_markers: Adds markers to list.
-	//	- m_kpmHandle: Initializes.
-	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-	bool loadMarkers(const std::string &markerFilePath);
-
-
-
-	// Update subroutines
-
-	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-	// DESCRIPTION: Updates image that stores the camera frame.
-	// MUTATES:
-	//		- mp_cameraFrame: gets new frame from camera
-	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-	void updateCameraFrame();
-
-	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-	// DESCRIPTION: Performs AR tracking on markers and updates them with results.
-	// MUTATES:
-	//		- m_markers: If markers appear within frame.
-	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-	void updateMarkers();
-
-	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-	// DESCRIPTION: Starts camera and marker reading.
-	// MUTATES:
-	//	- m_running
-	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-	bool start();
-
-	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-	// DESCRIPTION: Stops camera and marker reading.
-	// MUTATES:
-	//	- m_running
-	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-	void stop();
-
-
-	// GETTERS AND SETTERS
-	ARPose getMarkerPose(int markerNumber) const;
-	ARPose getMarkerPose(const std::string &markerName) const;
-	ARPose getOffsetMarkerPose(int markerNumber) const;
-	ARPose getOffsetMarkerPose(const std::string &markerName) const;
-	ARPose getMarkerOffset(int markerNumber) const;
-	ARPose getMarkerOffset(const std::string &markerName) const;
-	float getMarkerError(int markerNumber) const;
-
-	inline void setErrorTolerance(float errorTol) { m_errorTolerance = errorTol; }
-	inline bool isRunning() { return m_running; }
-	inline Image* getCameraFramePtr() const { return mp_cameraFrame; }
-	inline ARParamLT* getCameraParamLTPtr() { return mp_camera->getCameraParamLTPtr(); }
-	int getMarkerPageNumber(std::string &markerName) const;
-	inline AR_PIXEL_FORMAT getARPixelFormat() { return mp_camera->getPixelFormat(); }
-
-	inline ARHandle* getARHandlePtr() { return mp_arHandle; }
-
-	inline void setNumberOfPasses(unsigned int num) { m_numberOfPasses = num; }
-	inline void setPassIncrement(int interval) { m_passIncrement = interval; } // Sets the amount to increase threshold between passes.
-	void setBaseThreshold(unsigned int threshold);  // Threshold is of range [0, 255]
-	int getBaseThreshold() const { return m_baseThreshold; }
-
-	void toggleVerbose() { m_verbose = !m_verbose; }
-
-protected:
-	bool m_running;
-	bool m_verbose;			// Prints out marker detection when true;
-	float m_errorTolerance;	// Lower bound
-	unsigned int m_numberOfPasses;	// Number of times to scan mp_cameraFrame
-	int m_passIncrement;		// Amount to increment threshold per pass.
-	int m_baseThreshold;
-
-	std::vector<ARMarker*> m_markers;
-	ARCamera* mp_camera;
-	Image* mp_cameraFrame;
-	ARHandle* mp_arHandle;
-	AR3DHandle* mp_ar3dHandle;
+//================================================================================//
+// ARManager
+//	- Manager class for ARMarkers
+//--------------------------------------------------------------------------------//
+// AUTHOR: Glen Straughn
+// DATE: 01.16.2018
+// COMPILER: Microsoft Visual C++
+//--------------------------------------------------------------------------------//
+// NOTE: This class currently only supports glyph markers, because I have no reason
+//		 to incorporate NFT functionality.
+//================================================================================//
+#pragma once
+
+#include<AR/ar.h>
+
+#include<vector>
+#include<string>
+#include<thread>
+#include<atomic>
+#include<chrono>
+#include<functional>
+
+#include "ARMarker.hpp"
+#include "GlyphMarker.hpp"
+#include "MatrixCodeMarker.hpp"
+#include "ARCamera.hpp"
+#include "FrameRing.hpp"
+#include "FramePool.hpp"
+#include "LumaPlane.hpp"
+#include "LumaHistogram.hpp"
+#include "ComponentTree.hpp"
+#include "LabelingEngine.hpp"
+#include "PatternBank.hpp"
+#include "CornerTracker.hpp"
+#include "VisibilityCuller.hpp"
+#include "TrackingSnapshot.hpp"
+#include "TiledDetector.hpp"
+#include "ThreadPool.hpp"
+#include "TypeDef.hpp"
+
+
+// How full-resolution searches find dark squares.
+enum class LabelingMethod
+{
+	ARTOOLKIT,			// arDetectMarker() per pass
+	COMPONENT_TREE,		// One ComponentTree sweep for every pass threshold
+	ENGINE				// A LabelingEngine per pass, labeled in row bands
+};
+
+
+// One threshold pass of a full search. Passes run concurrently, so each labels with its own handles.
+struct DetectionPass
+{
+	unsigned int step;				// Threshold is the base threshold plus step pass increments
+	int threshold;
+	ARHandle* p_handle;				// Full-resolution handle; mp_arHandle for the first pass
+	ARHandle* p_coarseHandle;		// Labels the downsampled plane, when the pyramid is used
+	TiledDetector* p_tiles;			// Tiles of the full-resolution frame, when tiling is used
+	LabelingEngine* p_engine;		// Labels the luma plane, with LabelingMethod::ENGINE
+	std::vector<ComponentQuad> quads;		// Quads the engine found
+	std::vector<ARMarkerInfo> candidates;	// Refined candidates of the coarse plane, tree or engine
+	ARMarkerInfo* p_markerInfo;		// Results of the last run, or NULL
+	int markerNum;
+};
+
+
+// Where a glyph marker's square should be this frame, projected from last frame's poses.
+struct ExpectedPattern
+{
+	int patternID;
+	ARdouble vertex[4][2];			// Ideal coordinates, in arGetTransMatSquare()'s order for dir 0
+	ARdouble pos[2];
+	ARdouble radius;				// Furthest corner from pos
+};
+
+
+
+class ARManager
+{
+public:
+	ARManager();
+	~ARManager();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Initialize camera and load parameters.
+	// MUTATES:
+	//	- mp_camera: Instantiates and initializes.
+	// NOTES: p_frameSource is handed to the camera, which takes ownership
+	//		  of it. The live video device is used when it is NULL.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool initCamera(const std::string &cameraParameterFilePath, FrameSource* p_frameSource = NULL);
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Initialize NFTManager.
+	// MUTATES:
+	//	- mp_frameBuffer, mp_frameView: Instantiates.
+	//	- m_AR2Handle: Instantiates.
+	// NOTES: Must be called after initCamera
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool initManager();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Load markers and configurations from file.
+	// MUTATES:
+	//	- m_markers: Adds markers to list.
+	//	- m_kpmHandle: Initializes.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool loadMarkers(const std::string &markerFilePath);
+
+
+
+	// Update subroutines
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Updates image that stores the camera frame.
+	// MUTATES:
+	//		- mp_cameraFrame: gets new frame from camera
+	//		- m_lumaPlane: rebuilt from the new frame
+	// NOTES: With threaded capture this only picks up the newest frame
+	//		  published by the capture thread; it never waits on the camera.
+	//		  With zero copy the frame is a view of the video driver's
+	//		  buffer and is only valid until the next call.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void updateCameraFrame();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Performs AR tracking on markers and updates them with results.
+	// MUTATES:
+	//		- m_markers: If markers appear within frame.
+	//		- m_snapshots: Publishes the frame's results.
+	// NOTES: Does nothing if the current frame has already been processed.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void updateMarkers();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Starts camera and marker reading.
+	// MUTATES:
+	//	- m_running
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool start();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Stops camera and marker reading.
+	// MUTATES:
+	//	- m_running
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void stop();
+
+
+	// GETTERS AND SETTERS
+	// Poses and errors are those of the last published snapshot, so any thread may read them.
+	ARPose getMarkerPose(int markerNumber) const;
+	ARPose getMarkerPose(const std::string &markerName) const;
+	ARPose getOffsetMarkerPose(int markerNumber) const;
+	ARPose getOffsetMarkerPose(const std::string &markerName) const;
+	ARPose getMarkerOffset(int markerNumber) const;
+	ARPose getMarkerOffset(const std::string &markerName) const;
+	float getMarkerError(int markerNumber) const;
+
+	// Every marker's results, published once per frame by updateMarkers(); read them through a TrackingSnapshotReader.
+	inline const TrackingSnapshotBuffer& getSnapshots() const { return m_snapshots; }
+
+	inline void setErrorTolerance(float errorTol) { m_errorTolerance = errorTol; }
+	inline bool isRunning() { return m_running; }
+	inline Image* getCameraFramePtr() const { return mp_cameraFrame; }
+	inline FramePool* getFramePoolPtr() { return mp_framePool; }	// Camera-frame-sized images
+	inline LumaPlane* getLumaPlanePtr() { return &m_lumaPlane; }
+	inline unsigned long long getFrameSequence() const { return m_frameSequence; }	// Camera's sequence number of the current frame
+	inline std::chrono::steady_clock::time_point getFrameTimestamp() const { return m_frameTimestamp; }
+	inline ARParamLT* getCameraParamLTPtr() { return mp_camera->getCameraParamLTPtr(); }
+	int getMarkerPageNumber(std::string &markerName) const;
+	inline AR_PIXEL_FORMAT getARPixelFormat() { return mp_camera->getPixelFormat(); }
+	inline FrameSource* getFrameSourcePtr() { return mp_camera->getFrameSourcePtr(); }
+
+	inline ARHandle* getARHandlePtr() { return mp_arHandle; }
+
+	inline void setNumberOfPasses(unsigned int num) { m_numberOfPasses = num; }
+	inline void setPassIncrement(int interval) { m_passIncrement = interval; } // Sets the amount to increase threshold between passes.
+
+	// When enabled, the most productive pass runs first and the rest are skipped if it matched every
+	// marker expected in view (those visible last frame, or all of them) with at least minConfidence.
+	inline void setEarlyTermination(bool enabled, float minConfidence) { m_earlyTermination = enabled; m_terminationConfidence = minConfidence; }
+	void setBaseThreshold(unsigned int threshold);  // Threshold is of range [0, 255]
+
+	// Chooses the first pass thresholds from a histogram of each full-searched frame's luma plane instead
+	// of the base threshold; later passes step on from the last by the pass increment. With regionOnly,
+	// the histogram covers only the area around markers predicted in view, when there are any.
+	inline void setThresholdMode(ThresholdMode mode, bool regionOnly = false) { m_thresholdMode = mode; m_thresholdRegionOnly = regionOnly; }
+	inline void setThresholdPercentile(float fraction) { m_thresholdPercentile = fraction; } // Dark percentile for ThresholdMode::PERCENTILE
+	inline ThresholdMode getThresholdMode() const { return m_thresholdMode; }
+	int getBaseThreshold() const { return m_baseThreshold; }
+
+	void toggleVerbose() { m_verbose = !m_verbose; }
+
+	inline void setThreadedCapture(bool threaded) { m_threadedCapture = threaded; } // Takes effect on start().
+	inline bool isThreadedCapture() const { return m_threadedCapture; }
+	inline void setZeroCopy(bool zeroCopy) { m_zeroCopy = zeroCopy; } // Ignored with threaded capture.
+
+	// When enabled, ARToolKit labels and matches patterns on m_lumaPlane instead of the packed frame.
+	inline void setLumaDetection(bool enabled) { m_lumaDetection = enabled; }
+	void setHalfResolutionLuma(bool enabled);
+
+	// Finds candidates on the luma plane downsampled 2^level times (0 = full resolution, at most 2),
+	// then refines and identifies them on the full-resolution plane.
+	void setPyramidLevel(int level);
+	inline int getPyramidLevel() const { return m_pyramidLevel; }
+
+	// When enabled, markers tracked last frame are searched for only around their predicted
+	// corners, and the full frame is searched every m_fullSearchInterval frames or after a loss.
+	inline void setROITracking(bool enabled) { m_roiTracking = enabled; }
+	inline void setROIVelocity(bool enabled) { m_roiVelocity = enabled; }
+	inline void setROIPadding(float padding) { m_roiPadding = (padding < 1.0f) ? 1.0f : padding; } // Pixels
+	inline void setFullSearchInterval(unsigned int frames) { m_fullSearchInterval = (frames < 1) ? 1 : frames; }
+
+	// When enabled, markers in MarkerState::TRACKING are followed between full searches by tracking
+	// their corners with optical flow. Their patterns are checked by ROI detection every
+	// reidentifyInterval frames, or as soon as a corner's residual (mean absolute grey-level
+	// difference) exceeds maxResidual. Enables ROI frames on its own.
+	void setCornerTracking(bool enabled, unsigned int reidentifyInterval, float maxResidual);
+	inline CornerTracker& getCornerTracker() { return m_cornerTracker; }
+
+	// Splits full-resolution searches into rows x columns tiles that share overlap pixels
+	// and are detected in parallel. 1 x 1 detects on the whole frame.
+	void setTiledDetection(unsigned int rows, unsigned int columns, int overlap);
+
+	// How full-resolution searches label the frame. The project's own methods label the luma plane and
+	// replace tiling; pyramid detection takes precedence over them.
+	inline void setLabelingMethod(LabelingMethod method) { m_labelingMethod = method; freeEngines(); }
+	inline LabelingMethod getLabelingMethod() const { return m_labelingMethod; }
+
+	// When enabled, candidates this project labels, refines or tracks itself are identified against
+	// a bank of normalised templates with SIMD correlation instead of ARToolKit's pattern matching.
+	void setPatternBank(bool enabled);
+
+	// When enabled, the markers with offsets are treated as faces of one rigid body: the corners of
+	// every visible face are solved together for the body's pose, and each face's pose follows from it.
+	inline void setRigidBodyPose(bool enabled) { m_rigidBodyPose = enabled; m_rigidBodyValid = false; }
+
+	// When enabled, the body's pose decides which of its faces can be seen. Faces turned away from
+	// the camera by last frame's pose are neither tracked nor accepted from detection, and results
+	// mark faces whose facing cosine is at most cutoff, or whose centre is out of frame, as not visible.
+	inline void setVisibilityCulling(bool enabled, float cutoff) { m_visibilityCulling = enabled; m_visibilityCutoff = cutoff; }
+	inline bool getVisibilityCulling() const { return m_visibilityCulling; }
+
+	// When enabled with the pattern bank, a candidate lying where a marker is expected from last
+	// frame's poses is correlated only with that marker's pattern, in the rotation it should appear
+	// in, and against the whole bank only if that fails.
+	inline void setPatternHints(bool enabled) { m_patternHints = enabled; m_expectedPatterns.clear(); }
+
+	// When enabled, markers detected last frame are posed starting from last frame's transform, and
+	// every pose solve stops iterating once its residual (mean squared reprojection error, in px^2)
+	// reaches residualTarget or improves by less than 1%, after at most maxIterations. A seeded solve
+	// whose first iteration lands within a few times residualTarget gets at most one more.
+	void setContinuousPose(bool enabled, int maxIterations, float residualTarget);
+
+	// Threads used for parallel detection, including the caller; 0 for one per core.
+	inline void setDetectionThreads(unsigned int threads) { m_detectionThreads = threads; }
+
+protected:
+	bool m_running;
+	std::atomic<bool> m_verbose;	// Prints out marker detection when true; toggled from the UI thread
+	float m_errorTolerance;	// Lower bound
+	unsigned int m_numberOfPasses;	// Number of times to scan mp_cameraFrame, concurrently
+	int m_passIncrement;		// Amount to increment threshold per pass.
+	bool m_earlyTermination;	// Skip the remaining passes once the first finds every expected marker
+	float m_terminationConfidence;	// Confidence each expected marker needs for the rest to be skipped
+	std::vector<unsigned long long> m_passWins;	// Per threshold step: best matches it produced
+
+	// AUTOMATIC THRESHOLDS
+	ThresholdMode m_thresholdMode;
+	bool m_thresholdRegionOnly;		// Histogram only around predicted markers
+	float m_thresholdPercentile;
+	LumaHistogram m_histogram;
+	std::vector<int> m_autoThresholds;	// Chosen for the current frame; empty to use the base threshold
+
+	// OWN LABELING
+	LabelingMethod m_labelingMethod;
+	ComponentTree m_componentTree;
+	std::vector<std::vector<ComponentQuad>> m_componentQuads;	// Per threshold, ascending
+	bool m_patternBankEnabled;
+	PatternBank m_patternBank;	// Rebuilt whenever markers are loaded
+	std::atomic<int> m_baseThreshold;	// Set from the UI thread while frames are detected
+	bool m_threadedCapture;	// Capture on a dedicated thread through mp_frameRing.
+	bool m_zeroCopy;		// Read frames in place through mp_frameView.
+	bool m_lumaDetection;	// Detect on m_lumaPlane rather than the packed frame.
+	bool m_lumaValid;		// False when the camera's pixel format has no luma conversion.
+	bool m_markersCurrent;	// m_markers hold the results for mp_cameraFrame.
+	unsigned long long m_frameSequence;
+	std::chrono::steady_clock::time_point m_frameTimestamp;
+	AR_PIXEL_FORMAT m_detectionPixelFormat;	// Format mp_arHandle is currently set to
+	int m_pyramidLevel;		// Detection image is downsampled by 2^m_pyramidLevel
+	bool m_roiTracking;		// Track markers around their predicted corners between full searches.
+	bool m_roiVelocity;		// Extrapolate last frame's motion when predicting.
+	float m_roiPadding;		// How far, in pixels, an edge may be from its prediction.
+	unsigned int m_fullSearchInterval;
+	unsigned int m_framesSinceFullSearch;
+	unsigned int m_tileRows;
+	unsigned int m_tileColumns;
+	int m_tileOverlap;		// Pixels shared by neighbouring tiles
+	unsigned int m_detectionThreads;
+	bool m_rigidBodyPose;			// Solve the faces with offsets as one body
+	bool m_rigidBodyValid;			// m_rigidBodyTransform was solved last frame
+	ARdouble m_rigidBodyTransform[3][4];	// Camera from body
+	bool m_continuousPose;			// Seed pose solves with last frame's transforms
+	int m_poseMaxIterations;
+	ARdouble m_poseResidualTarget;	// Squared pixels
+
+	std::vector<ARMarker*> m_markers;
+	ARCamera* mp_camera;
+	Image* mp_cameraFrame;	// Current frame: mp_frameBuffer, mp_frameView, or a buffer in mp_frameRing.
+	FramePool* mp_framePool;	// Source of every frame-sized image
+	Image* mp_frameBuffer;	// Copy of the last frame, from mp_framePool
+	Image* mp_frameView;	// View of the frame source's buffer
+	LumaPlane m_lumaPlane;	// Luminance of mp_cameraFrame
+	ARHandle* mp_arHandle;
+	AR3DHandle* mp_ar3dHandle;
+
+	// PYRAMID DETECTION
+	ARParamLT* mp_coarseParamLT;	// Camera parameters scaled to the downsampled plane
+	int m_coarseLevel;				// Level the passes' coarse handles were created for
+	std::vector<ubyte> m_quarterPixels;
+	std::vector<ARMarkerInfo> m_detections;	// Best detection of each marker this frame
+	std::vector<int> m_detectionSteps;		// Threshold step of each marker's best detection, or -1
+
+	// CORNER TRACKING
+	bool m_cornerTracking;
+	unsigned int m_reidentifyInterval;	// Frames a marker may be corner tracked without detection
+	float m_maxCornerResidual;			// Grey levels
+	CornerTracker m_cornerTracker;
+	std::vector<unsigned int> m_cornerTrackAge;	// Per marker: frames corner tracked since it was last detected
+
+	// VISIBILITY CULLING
+	bool m_visibilityCulling;
+	float m_visibilityCutoff;		// Facing cosine a face needs to be reported visible
+	bool m_visibilityKnown;			// m_facing and m_inFrame hold a body pose's results
+	VisibilityCuller m_culler;
+	std::vector<int> m_cullerFaces;	// Per marker: its face in m_culler, or -1
+	std::vector<float> m_facing;	// Per culler face
+	std::vector<char> m_inFrame;
+	ARdouble m_bodyTransform[3][4];	// The pose the faces were last culled against
+
+	// MATRIX CODES
+	std::vector<MatrixCodeType> m_matrixCodeTypes;	// Distinct code types of the loaded matrix-code markers
+
+	// PATTERN HINTS
+	bool m_patternHints;
+	std::vector<ExpectedPattern> m_expectedPatterns;	// This frame's
+
+	// PUBLISHED RESULTS
+	TrackingSnapshotBuffer m_snapshots;
+
+	// PARALLEL DETECTION
+	std::vector<DetectionPass> m_passes;	// Sized to m_numberOfPasses when a full search starts
+	ThreadPool* mp_threadPool;				// Created with the first parallel work
+
+	// THREADED CAPTURE
+	FrameRing* mp_frameRing;
+	std::thread m_captureThread;
+	std::atomic<bool> m_capturing;
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Body of the capture thread. Copies each new camera
+	//				frame into the ring and publishes it.
+	// MUTATES:
+	//		- mp_frameRing: write buffer
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void captureLoop();
+	void stopCaptureThread();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Creates the coarse camera parameters and every pass's
+	//				coarse handle for m_pyramidLevel, replacing those of
+	//				another level.
+	// OUTPUT: False if ARToolKit failed to create them.
+	// MUTATES:
+	//		- m_passes' p_coarseHandle, mp_coarseParamLT, m_coarseLevel
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool initPyramid();
+	void freePyramid();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Creates every pass's tiles for the current tiling, and
+	//				the thread pool if there is none yet.
+	// OUTPUT: False if the tiles could not be created; tiling is then
+	//		   turned off.
+	// MUTATES:
+	//		- m_passes' p_tiles, mp_threadPool
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool initTiling();
+	void freeTiling();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Creates m_numberOfPasses passes, each after the first
+	//				with its own handle sharing mp_arHandle's patterns, and
+	//				the thread pool when there is more than one.
+	// OUTPUT: False if a handle could not be created; the passes that
+	//		   were created are kept.
+	// MUTATES:
+	//		- m_passes, mp_threadPool
+	// NOTES: Coarse handles and tiles are recreated when next needed.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool initPasses();
+	void freePasses();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Runs passes [first, first + count) at their thresholds
+	//				on the thread pool: one task per pass, or one per pass
+	//				and tile. With component tree labeling, every pass is
+	//				labeled in one sweep instead.
+	// INPUT:
+	//		- p_frame: Full-resolution detection image.
+	//		- p_coarseFrame: Downsampled luma plane, or NULL.
+	// MUTATES:
+	//		- m_passes: p_markerInfo and markerNum of the passes run.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void runPasses(unsigned int first, unsigned int count, ubyte* p_frame, ubyte* p_coarseFrame);
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Gives the passes their threshold steps, most productive
+	//				first; equally productive steps keep threshold order.
+	// MUTATES:
+	//		- m_passes: step and threshold of every pass.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void orderPasses();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Finds the candidates of passes [first, first + count)
+	//				with one component tree sweep of the luma plane, then
+	//				refines and identifies each distinct quad once, on the
+	//				thread pool.
+	// MUTATES:
+	//		- m_componentQuads
+	//		- m_passes: candidates, p_markerInfo and markerNum of the
+	//		  passes run.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void labelComponentTree(unsigned int first, unsigned int count);
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Refines and identifies candidates built from quads, on
+	//				the thread pool.
+	// MUTATES:
+	//		- candidates: Refined where their edges were found, and
+	//		  identified.
+	//		- identified: Per candidate, whether a pattern matched.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void identifyQuads(std::vector<ARMarkerInfo> &candidates, std::vector<char> &identified);
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Creates every pass's labeling engine for the luma
+	//				plane, with two row bands per detection thread, and the
+	//				thread pool if there is none yet.
+	// OUTPUT: False if the plane is too small; the ARToolKit labeling is
+	//		   then used.
+	// MUTATES:
+	//		- m_passes' p_engine, mp_threadPool
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool initEngines();
+
+	// The bank identifyCandidate() should use, or nullptr for ARToolKit's matching.
+	inline const PatternBank* getPatternBank() const { return m_patternBankEnabled ? &m_patternBank : nullptr; }
+	void freeEngines();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Chooses this frame's thresholds from the luma plane's
+	//				histogram, per m_thresholdMode.
+	// MUTATES:
+	//		- m_histogram, m_autoThresholds: emptied in manual mode or
+	//		  without a luma plane.
+	// NOTES: Reads the markers' predicted poses, so it runs before their
+	//		  states are updated.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void selectThresholds();
+
+	// Threshold of a threshold step: from m_autoThresholds when set, else from the base threshold.
+	int getStepThreshold(unsigned int step) const;
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Runs one untiled detection pass at its threshold. Only
+	//				touches the pass, so passes may run concurrently.
+	// INPUT:
+	//		- p_frame: Full-resolution detection image.
+	//		- p_coarseFrame: Downsampled luma plane, or NULL to label p_frame.
+	// MUTATES:
+	//		- pass: p_markerInfo (markers in full-frame ideal coordinates,
+	//		  or NULL), markerNum, and candidates when detecting on
+	//		  p_coarseFrame.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void detectCandidates(DetectionPass &pass, ubyte* p_frame, ubyte* p_coarseFrame);
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Matches detections to markers, keeping each marker's
+	//				most confident match.
+	// INPUT:
+	//		- step: Threshold step the detections came from, or -1.
+	// MUTATES:
+	//		- m_markers: error of matched markers.
+	//		- m_detections, m_detectionSteps: the match of each improved
+	//		  marker.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void applyDetections(ARMarkerInfo* p_markerInfo, int markerNum, int step = -1);
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Solves the pose of the rigid body from the corners of
+	//				all its faces detected this frame, with one ICP from
+	//				last frame's body pose or, failing that, from the most
+	//				confident face.
+	// OUTPUT: False if no face was detected or the solve failed; the
+	//		   faces then need poses of their own.
+	// MUTATES:
+	//		- m_rigidBodyTransform, m_rigidBodyValid
+	//		- m_markers: ARToolKit transform of every detected face.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool solveRigidBody();
+
+	// One ICP iteration from seed (NULL for a cold start) into result, returning the residual.
+	typedef std::function<ARdouble(ARdouble(*)[4], ARdouble(*)[4])> PoseStep;
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Repeats a pose step, each from the last result, until
+	//				the residual reaches m_poseResidualTarget, stops
+	//				improving or the iteration cap is hit. The cap is
+	//				m_poseMaxIterations, or SETTLED_MAX_ITERATIONS for a
+	//				seeded solve whose first step is already within
+	//				SETTLED_RESIDUAL_FACTOR of the target.
+	// OUTPUT: Residual of the result.
+	// INPUT:
+	//		- p_seed: Last frame's transform, or NULL to start cold.
+	// MUTATES:
+	//		- mp_ar3dHandle: ICP loop limit and error target, restored
+	//		  before returning.
+	// NOTES: Each step re-projects its starting pose, so n iterations
+	//		  cost about 2n error evaluations against n + 1 in one ICP
+	//		  call; the settled cap keeps n at one or two for held markers.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	ARdouble solvePose(const PoseStep &step, ARdouble(*p_seed)[4], ARdouble result[3][4]);
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Looks for a marker only around the corners predicted
+	//				from its last transforms.
+	// OUTPUT: True if the marker's pattern was found there.
+	// INPUT:
+	//		- index: Marker in m_markers.
+	//		- detection: Receives the refined corners and match.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool trackMarker(int index, ARMarkerInfo &detection);
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Moves a tracked marker's last detection to where its
+	//				corners went since the previous frame.
+	// OUTPUT: False if the marker is not in MarkerState::TRACKING or any
+	//		   corner was lost or exceeded m_maxCornerResidual.
+	// INPUT:
+	//		- index: Marker in m_markers.
+	//		- detection: Last frame's detection; receives the new corners,
+	//		  keeping its match.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool trackCorners(int index, ARMarkerInfo &detection);
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Culls the body's faces against its current pose: the
+	//				rigid-body solve's, or else the most confident valid
+	//				face's combined with its offset.
+	// MUTATES:
+	//		- m_visibilityKnown: False when no face is valid.
+	//		- m_facing, m_inFrame, m_bodyTransform
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void updateVisibility();
+
+	// Whether culling has marker index facing at most cutoff, or out of frame.
+	bool isCulled(int index, float cutoff) const;
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Copies every marker's results into the back snapshot
+	//				and publishes it.
+	// MUTATES:
+	//		- m_snapshots
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void publishSnapshot();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Projects every glyph marker with a known pose: its own
+	//				prediction when valid, or else the body's pose and its
+	//				offset when it is a face the culler found in view.
+	// MUTATES:
+	//		- m_expectedPatterns
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void predictPatterns();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Builds the hint for a candidate: every expected pattern
+	//				whose square contains the candidate's centre, in the
+	//				rotation that lines its corners up with the candidate's.
+	// OUTPUT: The hint, or nullptr if nothing is expected there.
+	// INPUT:
+	//	* candidate: Candidate with vertex and pos set.
+	//	* hint: Storage for the hint.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	const PatternHint* hintCandidate(const ARMarkerInfo &candidate, PatternHint &hint) const;
+
+	// Glyphs and matrix codes are both squares, found and tracked the same way.
+	static inline bool isSquare(MarkerType type) { return type == MarkerType::GLYPH || type == MarkerType::MATRIX_CODE; }
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Reads the squares no glyph claimed as every loaded
+	//				matrix code type.
+	// MUTATES:
+	//		- p_markerInfo: idMatrix receives the index in m_markers of the
+	//		  marker read (-1 if none), with dirMatrix and cfMatrix.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void readMatrixCodes(ARMarkerInfo* p_markerInfo, int markerNum);
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Whether a detection is marker index: its pattern for a
+	//				glyph, its barcode for a matrix code (after
+	//				readMatrixCodes()), with more than m_errorTolerance.
+	// INPUT:
+	//	* dir, cf: Receive the rotation and confidence it was matched with.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool matchDetection(int index, const ARMarkerInfo &detection, int &dir, ARdouble &cf);
 };
\ No newline at end of file
@@ -1,39 +1,113 @@
-//================================================================================//
-// ARMarker.hpp
-//	- Abstract class to represent an ARToolkit Marker.
-//--------------------------------------------------------------------------------//
-// AUTHOR: Glen Straughn
-// DATE: 01.16.2018
-// COMPILER: Microsoft Visual C++
-//================================================================================//
-#include "ARMarker.hpp"
-#include <AR/gsub_lite.h>
-
-#include "Parsing.h"
-#include "StringAndNumberConversion.hpp"
-
-
-ARMarker::ARMarker()
-{
-	// INITIALIZE ID
-	static UID id = 0;
-	m_markerID = id;
-	id++;
-
-	//INITIALIZE STATE
-	m_state = MarkerState::UNREGISTERED;
-}
-
-
-//================================================================================//
-
-
-MarkerType parseType(const std::string& text)
-{
-	std::string workingString = toLower(text);
-	
-	if (workingString == "glyph") return MarkerType::GLYPH;
-	else if (workingString == "nft") return MarkerType::NFT;
-
-	return MarkerType::INVALID; // If no correct marker type is detected
+//================================================================================//
+// ARMarker.hpp
+//	- Abstract class to represent an ARToolkit Marker.
+//--------------------------------------------------------------------------------//
+// AUTHOR: Glen Straughn
+// DATE: 01.16.2018
+// COMPILER: Microsoft Visual C++
+//================================================================================//
+#include "ARMarker.hpp"
+#include <AR/gsub_lite.h>
+
+#include "Parsing.h"
+#include "StringAndNumberConversion.hpp"
+#include "Util.hpp"
+
+
+ARMarker::ARMarker()
+{
+	// INITIALIZE ID
+	static UID id = 0;
+	m_markerID = id;
+	id++;
+
+	//INITIALIZE STATE
+	m_state = MarkerState::UNREGISTERED;
+	m_hasOffset = false;
+	for (int r = 0; r < 3; r++)
+	{
+		for (int c = 0; c < 4; c++)
+		{
+			m_arTransform[r][c] = m_previousARTransform[r][c] = (r == c) ? 1 : 0;
+		}
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARMarker::setARTransform(ARdouble transform[3][4])
+{
+	for (int r = 0; r < 3; r++)
+	{
+		for (int c = 0; c < 4; c++)
+		{
+			m_previousARTransform[r][c] = m_arTransform[r][c];
+			m_arTransform[r][c] = transform[r][c];
+		}
+	}
+
+	m_pose = makeGLMatrixFromAR(transform);
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARMarker::getARTransform(ARdouble transform[3][4]) const
+{
+	for (int r = 0; r < 3; r++)
+	{
+		for (int c = 0; c < 4; c++)
+		{
+			transform[r][c] = m_arTransform[r][c];
+		}
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool ARMarker::predictARTransform(ARdouble prediction[3][4], bool useVelocity) const
+{
+	if (!isValid())
+	{
+		return false;
+	}
+
+	// TRACKING means the marker was also detected the frame before, so both transforms are recent.
+	if (!useVelocity || m_state != MarkerState::TRACKING)
+	{
+		getARTransform(prediction);
+		return true;
+	}
+
+	// Apply last frame's motion once more: prediction = (current * previous^-1) * current
+	ARdouble inverse[3][4], motion[3][4];
+	if (arUtilMatInv(m_previousARTransform, inverse) < 0)
+	{
+		getARTransform(prediction);
+		return true;
+	}
+	arUtilMatMul(m_arTransform, inverse, motion);
+	arUtilMatMul(motion, m_arTransform, prediction);
+
+	return true;
+}
+
+
+//================================================================================//
+
+
+MarkerType parseType(const std::string& text)
+{
+	std::string workingString = toLower(text);
+	
+	if (workingString == "glyph") return MarkerType::GLYPH;
+	else if (workingString == "nft") return MarkerType::NFT;
+	else if (workingString == "matrix code" || workingString == "matrix_code") return MarkerType::MATRIX_CODE;
+
+	return MarkerType::INVALID; // If no correct marker type is detected
 }
\ No newline at end of file
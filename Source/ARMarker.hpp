@@ -1,84 +1,117 @@
-//================================================================================//
-// ARMarker.hpp
-//	- Abstract class to represent an ARToolkit Marker.
-//--------------------------------------------------------------------------------//
-// AUTHOR: Glen Straughn
-// DATE: 01.16.2018
-// COMPILER: Microsoft Visual C++
-//================================================================================//
-#pragma once
-
-#include<AR/ar.h>
-#include<string>
-
-#include "TypeDef.hpp"
-
-
-// ENUMERATIONS
-enum class MarkerState
-{
-	DETECTED,
-	TRACKING,
-	LOST,
-	UNREGISTERED
-};
-
-enum class MarkerType
-{
-	GLYPH,
-	NFT,
-	INVALID = -1 // Used as a default value for the function parseType
-};
-
-
-
-class ARMarker
-{
-public:
-	ARMarker();
-
-	ARPose getPose() const { return m_pose; }
-	ARPose getOffsetPose() const { return m_pose * m_offset; }
-	inline ARPose getOffset() const { return m_offset; }
-
-	inline bool isValid() const { return (m_state == MarkerState::DETECTED || m_state == MarkerState::TRACKING); }
-	inline void setState(MarkerState state) { m_state = state; }
-	inline MarkerState getState() const { return m_state; }
-
-	inline void setTransform(ARPose t) { m_pose = t; };
-
-	inline int getMarkerID() const { return m_markerID; }
-	inline std::string getName() { return m_name; }
-
-	inline void setOffset(glm::mat4x4 offset) { m_offset = offset; }
-
-	inline ARfloat getError() { return m_error; }
-	inline void setError(ARfloat error) { m_error = error; }
-
-	virtual inline MarkerType getType() = 0; // Virtual
-
-protected:
-	ARfloat		m_error;
-	std::string m_name;
-	
-	MarkerState m_state;
-	ARPose		m_pose;
-	ARPose		m_offset;		// Offset for 3D marker tracking
-	ARdouble    m_markerWidth;
-	ARdouble    m_markerHeight;
-
-private:
-	int         m_markerID;
-};
-
-
-//===========================================================================//
-
-
-//---------------------------------------------------------------------------//
-// DESCRIPTION: Utility function to help parse marker types from file contents.
-// OUTPUT: String that possibly contains a marker type
-// ARGUMENTS:
-//	- text: String to be interpreted as a marker type (e.g. "nft").
-//---------------------------------------------------------------------------//
+//================================================================================//
+// ARMarker.hpp
+//	- Abstract class to represent an ARToolkit Marker.
+//--------------------------------------------------------------------------------//
+// AUTHOR: Glen Straughn
+// DATE: 01.16.2018
+// COMPILER: Microsoft Visual C++
+//================================================================================//
+#pragma once
+
+#include<AR/ar.h>
+#include<string>
+
+#include "TypeDef.hpp"
+
+
+// ENUMERATIONS
+enum class MarkerState
+{
+	DETECTED,
+	TRACKING,
+	LOST,
+	UNREGISTERED
+};
+
+enum class MarkerType
+{
+	GLYPH,
+	NFT,
+	MATRIX_CODE,
+	INVALID = -1 // Used as a default value for the function parseType
+};
+
+
+// Copy of a marker's tracking results, safe to hand to other threads.
+struct MarkerResult
+{
+	int markerID;
+	MarkerState state;
+	ARfloat error;		// Confidence; -1 if the marker is not valid
+	ARPose pose;
+	ARPose offsetPose;
+	bool visible;		// False when visibility culling found the face turned away or out of frame
+	bool visibilityKnown;	// Culling tested the face against a body pose; otherwise visible is always true
+};
+
+
+
+class ARMarker
+{
+public:
+	ARMarker();
+	virtual ~ARMarker() {}	// Markers are deleted through ARMarker*
+
+	ARPose getPose() const { return m_pose; }
+	ARPose getOffsetPose() const { return m_pose * m_offset; }
+	inline ARPose getOffset() const { return m_offset; }
+
+	inline bool isValid() const { return (m_state == MarkerState::DETECTED || m_state == MarkerState::TRACKING); }
+	inline void setState(MarkerState state) { m_state = state; }
+	inline MarkerState getState() const { return m_state; }
+
+	inline void setTransform(ARPose t) { m_pose = t; };
+
+	// ARToolKit's camera-from-marker transform; also sets the pose. Call at most once per frame,
+	// since the transform it replaces is kept for motion prediction.
+	void setARTransform(ARdouble transform[3][4]);
+	void getARTransform(ARdouble transform[3][4]) const;
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Predicts this frame's transform from the last ones.
+	// OUTPUT: False if the marker was not detected last frame.
+	// INPUT:
+	//	- useVelocity: Extrapolates the motion between the last two
+	//				   frames when the marker was seen in both.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool predictARTransform(ARdouble prediction[3][4], bool useVelocity) const;
+
+	inline int getMarkerID() const { return m_markerID; }
+	inline std::string getName() { return m_name; }
+
+	inline void setOffset(glm::mat4x4 offset) { m_offset = offset; m_hasOffset = true; }
+	inline bool hasOffset() const { return m_hasOffset; }	// Set for the faces of a rigid body
+
+	inline ARfloat getError() { return m_error; }
+	inline void setError(ARfloat error) { m_error = error; }
+
+	virtual inline MarkerType getType() = 0; // Virtual
+
+protected:
+	ARfloat		m_error;
+	std::string m_name;
+	
+	MarkerState m_state;
+	ARPose		m_pose;
+	ARPose		m_offset;		// Offset for 3D marker tracking
+	bool		m_hasOffset;
+	ARdouble    m_markerWidth;
+	ARdouble    m_markerHeight;
+	ARdouble	m_arTransform[3][4];
+	ARdouble	m_previousARTransform[3][4];
+
+private:
+	int         m_markerID;
+};
+
+
+//===========================================================================//
+
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Utility function to help parse marker types from file contents.
+// OUTPUT: String that possibly contains a marker type
+// ARGUMENTS:
+//	- text: String to be interpreted as a marker type (e.g. "nft").
+//---------------------------------------------------------------------------//
 MarkerType parseType(const std::string& text);
\ No newline at end of file
@@ -0,0 +1,197 @@
+//================================================================================//
+// ComponentTree
+//	- Labels the dark components of a luma plane at several thresholds in one
+//	  sweep and fits square marker candidates to them.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//================================================================================//
+#include "ComponentTree.hpp"
+
+#include <AR/ar.h>
+#include <algorithm>
+
+
+ComponentTree::ComponentTree()
+{
+	m_width = 0;
+	m_height = 0;
+	m_minArea = AR_AREA_MIN;
+	m_maxArea = AR_AREA_MAX;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ComponentTree::extract(const ubyte* p_pixels, int width, int height, const std::vector<int> &thresholds,
+	std::vector<std::vector<ComponentQuad>> &quads)
+{
+	quads.assign(thresholds.size(), std::vector<ComponentQuad>());
+	if (thresholds.empty() || width < 3 || height < 3)
+	{
+		return;
+	}
+
+	int pixelCount = width * height;
+	int maxThreshold = std::min(std::max(thresholds.back(), 0), 255);
+	m_width = width;
+	m_height = height;
+	m_parent.assign(pixelCount, -1);
+	m_records.clear();
+	m_freeRecords.clear();
+
+	// DARK PIXELS BY VALUE (counting sort)
+	int starts[257] = { 0 };
+	for (int i = 0; i < pixelCount; i++)
+	{
+		if (p_pixels[i] <= maxThreshold) starts[p_pixels[i] + 1]++;
+	}
+	for (int v = 0; v < 256; v++)
+	{
+		starts[v + 1] += starts[v];
+	}
+
+	int positions[256];
+	std::copy(starts, starts + 256, positions);
+	m_order.resize(starts[maxThreshold + 1]);
+	for (int i = 0; i < pixelCount; i++)
+	{
+		if (p_pixels[i] <= maxThreshold) m_order[positions[p_pixels[i]]++] = i;
+	}
+
+	// SWEEP, fitting the components each time a threshold is reached
+	int next = 0;
+	for (int k = 0; k < thresholds.size(); k++)
+	{
+		int threshold = std::min(std::max(thresholds[k], 0), 255);
+		for (; next < starts[threshold + 1]; next++)
+		{
+			addPixel(m_order[next]);
+		}
+
+		for (Record &record : m_records)
+		{
+			if (!record.alive) continue;
+
+			int quadIndex = -1;
+			if (record.snapshotArea == record.shape.area)
+			{
+				// Same pixels as at the previous threshold; so is the quad.
+				if (record.snapshotQuad >= 0)
+				{
+					quadIndex = (int)quads[k].size();
+					quads[k].push_back(quads[k - 1][record.snapshotQuad]);
+					quads[k].back().previous = record.snapshotQuad;
+				}
+			}
+			else if (record.shape.area >= m_minArea && record.shape.area <= m_maxArea)
+			{
+				ComponentQuad quad;
+				if (fitComponentQuad(record.shape, m_width, m_height, m_minArea, quad))
+				{
+					quadIndex = (int)quads[k].size();
+					quads[k].push_back(quad);
+				}
+			}
+
+			record.snapshotArea = record.shape.area;
+			record.snapshotQuad = quadIndex;
+		}
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+int ComponentTree::findRoot(int pixel)
+{
+	// Path halving keeps the trees shallow without recursion.
+	while (m_parent[pixel] >= 0)
+	{
+		int parent = m_parent[pixel];
+		if (m_parent[parent] >= 0)
+		{
+			m_parent[pixel] = m_parent[parent];
+		}
+		pixel = parent;
+	}
+
+	return pixel;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ComponentTree::addPixel(int pixel)
+{
+	int x = pixel % m_width;
+	int y = pixel / m_width;
+
+	int recordIndex;
+	if (!m_freeRecords.empty())
+	{
+		recordIndex = m_freeRecords.back();
+		m_freeRecords.pop_back();
+	}
+	else
+	{
+		recordIndex = (int)m_records.size();
+		m_records.push_back(Record());
+	}
+
+	Record &record = m_records[recordIndex];
+	resetExtremes(record.shape);
+	addRunToExtremes(record.shape, x, x, y);
+	record.snapshotArea = 0;
+	record.snapshotQuad = -1;
+	record.alive = true;
+	m_parent[pixel] = -(recordIndex + 2);
+
+	// Join the 8-connected neighbours added before.
+	for (int dy = -1; dy <= 1; dy++)
+	{
+		if (y + dy < 0 || y + dy >= m_height) continue;
+
+		for (int dx = -1; dx <= 1; dx++)
+		{
+			int neighbour = pixel + dy * m_width + dx;
+			if ((dx == 0 && dy == 0) || x + dx < 0 || x + dx >= m_width || m_parent[neighbour] == -1) continue;
+
+			int rootA = findRoot(pixel);
+			int rootB = findRoot(neighbour);
+			if (rootA != rootB)
+			{
+				merge(rootA, rootB);
+			}
+		}
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ComponentTree::merge(int rootA, int rootB)
+{
+	int indexA = -(m_parent[rootA] + 2);
+	int indexB = -(m_parent[rootB] + 2);
+
+	// The smaller tree hangs under the larger.
+	if (m_records[indexA].shape.area < m_records[indexB].shape.area)
+	{
+		std::swap(rootA, rootB);
+		std::swap(indexA, indexB);
+	}
+
+	Record &kept = m_records[indexA];
+	Record &absorbed = m_records[indexB];
+
+	mergeExtremes(kept.shape, absorbed.shape);
+
+	absorbed.alive = false;
+	m_freeRecords.push_back(indexB);
+	m_parent[rootB] = rootA;
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+//================================================================================//
+// ComponentTree
+//	- Labels the dark components of a luma plane at several thresholds in one
+//	  sweep and fits square marker candidates to them.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//--------------------------------------------------------------------------------//
+// NOTE: Pixels are added darkest first, merging with 8-connected neighbours
+//		 added before them (union-find), as in MSER. Once every pixel at or
+//		 below a threshold has been added, the components are exactly those
+//		 ARToolKit would label at that threshold. Their quads are taken
+//		 without relabeling. Pixels brighter than the highest threshold are
+//		 never touched.
+//		 Quads come from each component's extreme pixels; see
+//		 fitComponentQuad().
+//================================================================================//
+#pragma once
+
+#include<vector>
+#include<cstdint>
+
+#include "TypeDef.hpp"
+#include "MarkerCandidates.hpp"
+
+
+class ComponentTree
+{
+public:
+	ComponentTree();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Finds the quads of the dark components at every
+	//				threshold.
+	// INPUT:
+	//	* p_pixels: Luma plane of width * height bytes.
+	//	* thresholds: Ascending thresholds; pixels at or below one are dark.
+	//	* quads: Receives one list of quads per threshold.
+	// MUTATES:
+	//	- m_parent, m_order, m_records: Kept between frames to avoid
+	//	  reallocating.
+	// NOTES: Components touching the plane's border are skipped, as
+	//		  ARToolKit skips them.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void extract(const ubyte* p_pixels, int width, int height, const std::vector<int> &thresholds,
+		std::vector<std::vector<ComponentQuad>> &quads);
+
+	// Components outside [minArea, maxArea] pixels are not fitted.
+	inline void setAreaLimits(int minArea, int maxArea) { m_minArea = minArea; m_maxArea = maxArea; }
+
+private:
+	struct Record
+	{
+		ComponentExtremes shape;
+		int snapshotArea;		// Area when last fitted; unchanged means the same pixels
+		int snapshotQuad;		// Quad it produced then, or -1
+		bool alive;
+	};
+
+	std::vector<int32_t> m_parent;	// Per pixel: -1 if not added, -(record + 2) at roots, else the parent pixel
+	std::vector<int32_t> m_order;	// Dark pixels sorted by value
+	std::vector<Record> m_records;
+	std::vector<int> m_freeRecords;
+	int m_width;
+	int m_height;
+	int m_minArea;
+	int m_maxArea;
+
+	int findRoot(int pixel);
+	void addPixel(int pixel);
+	void merge(int rootA, int rootB);
+};
\ No newline at end of file
@@ -0,0 +1,217 @@
+//================================================================================//
+// CornerTracker
+//	- Follows points from one luma frame to the next with pyramidal
+//	  Lucas-Kanade optical flow.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//================================================================================//
+#include "CornerTracker.hpp"
+
+#include <cmath>
+#include <cstring>
+
+static const int MAX_ITERATIONS = 10;		// Per pyramid level
+static const float MIN_STEP = 0.01f;		// Pixels; smaller updates end a level early
+static const float MIN_EIGENVALUE = 1e-3f;	// Per window pixel, in squared grey levels; flatter windows are untrackable
+
+
+CornerTracker::CornerTracker()
+{
+	m_hasPrevious = false;
+	m_hasCurrent = false;
+	m_levels = 3;
+	m_windowRadius = 5;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void CornerTracker::setLevels(int levels)
+{
+	m_levels = (levels < 1) ? 1 : levels;
+	reset();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void CornerTracker::nextFrame(const LumaPlane &luma)
+{
+	m_previous.swap(m_current);
+	m_hasPrevious = m_hasCurrent;
+
+	// LEVEL 0 is a copy, since the plane is rebuilt in place next frame.
+	m_current.resize(m_levels);
+	m_current[0].width = (int)luma.getWidth();
+	m_current[0].height = (int)luma.getHeight();
+	m_current[0].pixels.assign(luma.getPixels(), luma.getPixels() + luma.getWidth() * luma.getHeight());
+
+	int levels = 1;
+	for (; levels < m_levels; levels++)
+	{
+		const Level &finer = m_current[levels - 1];
+		Level &coarser = m_current[levels];
+		if (finer.width < 2 * (2 * m_windowRadius + 1) || finer.height < 2 * (2 * m_windowRadius + 1))
+		{
+			break; // Too small to hold a window once halved
+		}
+
+		coarser.width = finer.width / 2;
+		coarser.height = finer.height / 2;
+		coarser.pixels.resize((size_t)coarser.width * coarser.height);
+		halveLuma(finer.pixels.data(), finer.width, finer.height, coarser.pixels.data());
+	}
+	m_current.resize(levels);
+
+	m_hasCurrent = true;
+	m_hasPrevious = m_hasPrevious && m_previous.size() == m_current.size()
+		&& m_previous[0].width == m_current[0].width && m_previous[0].height == m_current[0].height;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void CornerTracker::reset()
+{
+	m_hasPrevious = m_hasCurrent = false;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool CornerTracker::track(const float from[2], float to[2], float &residual) const
+{
+	if (!m_hasPrevious)
+	{
+		return false;
+	}
+
+	int windowSize = 2 * m_windowRadius + 1;
+	int windowPixels = windowSize * windowSize;
+	std::vector<float> window(windowPixels), gradientX(windowPixels), gradientY(windowPixels);
+
+	float guess[2] = { 0.0f, 0.0f };	// Motion carried down from the coarser levels
+	float motion[2] = { 0.0f, 0.0f };
+
+	for (int l = (int)m_previous.size() - 1; l >= 0; l--)
+	{
+		const Level &previous = m_previous[l];
+		const Level &current = m_current[l];
+		float scale = 1.0f / (float)(1 << l);
+		float x = from[0] * scale, y = from[1] * scale;
+
+		// The window and its gradient must lie inside the previous level.
+		if (x - m_windowRadius < 1 || y - m_windowRadius < 1
+			|| x + m_windowRadius >= previous.width - 2 || y + m_windowRadius >= previous.height - 2)
+		{
+			return false;
+		}
+
+		// SPATIAL GRADIENT MATRIX of the previous frame's window
+		float gxx = 0.0f, gxy = 0.0f, gyy = 0.0f;
+		int index = 0;
+		for (int dy = -m_windowRadius; dy <= m_windowRadius; dy++)
+		{
+			for (int dx = -m_windowRadius; dx <= m_windowRadius; dx++, index++)
+			{
+				float px = x + dx, py = y + dy;
+				window[index] = sample(previous, px, py);
+				gradientX[index] = (sample(previous, px + 1, py) - sample(previous, px - 1, py)) * 0.5f;
+				gradientY[index] = (sample(previous, px, py + 1) - sample(previous, px, py - 1)) * 0.5f;
+				gxx += gradientX[index] * gradientX[index];
+				gxy += gradientX[index] * gradientY[index];
+				gyy += gradientY[index] * gradientY[index];
+			}
+		}
+
+		float determinant = gxx * gyy - gxy * gxy;
+		float minEigenvalue = (gxx + gyy - sqrtf((gxx - gyy) * (gxx - gyy) + 4.0f * gxy * gxy)) * 0.5f;
+		if (minEigenvalue < MIN_EIGENVALUE * (float)windowPixels || determinant <= 0.0f)
+		{
+			return false;
+		}
+
+		// ITERATIVE LUCAS-KANADE on this level
+		motion[0] = motion[1] = 0.0f;
+		for (int iteration = 0; iteration < MAX_ITERATIONS; iteration++)
+		{
+			float cx = x + guess[0] + motion[0], cy = y + guess[1] + motion[1];
+			if (cx - m_windowRadius < 0 || cy - m_windowRadius < 0
+				|| cx + m_windowRadius >= current.width - 1 || cy + m_windowRadius >= current.height - 1)
+			{
+				return false;
+			}
+
+			float bx = 0.0f, by = 0.0f;
+			index = 0;
+			for (int dy = -m_windowRadius; dy <= m_windowRadius; dy++)
+			{
+				for (int dx = -m_windowRadius; dx <= m_windowRadius; dx++, index++)
+				{
+					float difference = window[index] - sample(current, cx + dx, cy + dy);
+					bx += difference * gradientX[index];
+					by += difference * gradientY[index];
+				}
+			}
+
+			float stepX = (gyy * bx - gxy * by) / determinant;
+			float stepY = (gxx * by - gxy * bx) / determinant;
+			motion[0] += stepX;
+			motion[1] += stepY;
+			if (stepX * stepX + stepY * stepY < MIN_STEP * MIN_STEP)
+			{
+				break;
+			}
+		}
+
+		if (l > 0)
+		{
+			guess[0] = 2.0f * (guess[0] + motion[0]);
+			guess[1] = 2.0f * (guess[1] + motion[1]);
+		}
+	}
+
+	to[0] = from[0] + guess[0] + motion[0];
+	to[1] = from[1] + guess[1] + motion[1];
+
+	const Level &current = m_current[0];
+	if (to[0] - m_windowRadius < 0 || to[1] - m_windowRadius < 0
+		|| to[0] + m_windowRadius >= current.width - 1 || to[1] + m_windowRadius >= current.height - 1)
+	{
+		return false;
+	}
+
+	// RESIDUAL at full resolution; window still holds level 0 of the previous frame.
+	float sum = 0.0f;
+	int index = 0;
+	for (int dy = -m_windowRadius; dy <= m_windowRadius; dy++)
+	{
+		for (int dx = -m_windowRadius; dx <= m_windowRadius; dx++, index++)
+		{
+			sum += fabsf(window[index] - sample(current, to[0] + dx, to[1] + dy));
+		}
+	}
+	residual = sum / (float)windowPixels;
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+float CornerTracker::sample(const Level &level, float x, float y)
+{
+	int x0 = (int)x, y0 = (int)y;
+	float fx = x - (float)x0, fy = y - (float)y0;
+	const ubyte* p_row = &level.pixels[(size_t)y0 * level.width + x0];
+
+	float top = p_row[0] + (p_row[1] - p_row[0]) * fx;
+	float bottom = p_row[level.width] + (p_row[level.width + 1] - p_row[level.width]) * fx;
+	return top + (bottom - top) * fy;
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+//================================================================================//
+// CornerTracker
+//	- Follows points from one luma frame to the next with pyramidal
+//	  Lucas-Kanade optical flow.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//--------------------------------------------------------------------------------//
+// NOTE: Each frame is kept as a pyramid of halved planes (halveLuma()).
+//		 A point is first tracked on the coarsest level. Its motion is then
+//		 doubled and refined on each finer level (Bouguet's formulation), so
+//		 motions several times the window size are followed. Marker corners
+//		 suit it well: the two edges meeting there constrain both
+//		 directions. The residual is the mean absolute grey-level
+//		 difference between the windows at the final position; a corner
+//		 that left the window or was occluded shows up as a large residual.
+//================================================================================//
+#pragma once
+
+#include<vector>
+
+#include "TypeDef.hpp"
+#include "LumaPlane.hpp"
+
+
+class CornerTracker
+{
+public:
+	CornerTracker();
+
+	// Pyramid levels (1 tracks on the full-resolution plane only) and the window's half size in pixels.
+	void setLevels(int levels);
+	inline void setWindowRadius(int radius) { m_windowRadius = (radius < 1) ? 1 : radius; }
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Makes luma the current frame and the previous current
+	//				frame the one points are tracked from.
+	// MUTATES:
+	//	- m_previous, m_current: Swapped, then the current pyramid rebuilt.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void nextFrame(const LumaPlane &luma);
+
+	// Forgets both frames, so nothing is tracked until two more have been given.
+	void reset();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Finds where a point of the previous frame is in the
+	//				current one.
+	// OUTPUT: False if there is no previous frame, the window is flat or
+	//		   the point left the frame.
+	// INPUT:
+	//	* from: Position in the previous frame, in plane pixels.
+	//	* to: Receives the position in the current frame.
+	//	* residual: Receives the mean absolute difference of the windows.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool track(const float from[2], float to[2], float &residual) const;
+
+	inline bool hasPrevious() const { return m_hasPrevious; }
+
+private:
+	struct Level
+	{
+		std::vector<ubyte> pixels;
+		int width;
+		int height;
+	};
+
+	std::vector<Level> m_previous;
+	std::vector<Level> m_current;
+	bool m_hasPrevious;
+	bool m_hasCurrent;
+	int m_levels;
+	int m_windowRadius;
+
+	static float sample(const Level &level, float x, float y);
+};
\ No newline at end of file
@@ -0,0 +1,319 @@
+//================================================================================//
+// FramePipeline
+//	- Staged frame processing across consecutive frames.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//================================================================================//
+#include "FramePipeline.hpp"
+
+#include "Parsing.h"
+
+
+FramePacket::FramePacket()
+{
+	sequence = 0;
+	frameSequence = 0;
+	p_image = NULL;
+	p_luma = NULL;
+
+	worldPose = ZERO_MATRIX_4X4;
+	dodecahedronPose = ZERO_MATRIX_4X4;
+
+	facesReplayed = false;
+
+	lightEstimated = false;
+	lightDirection = glm::vec3(0, 0, 0);
+	lightIntensity = 0;
+	ambientIntensity = 0;
+}
+
+
+//================================================================================//
+
+
+FrameQueue::FrameQueue(unsigned int capacity, BackPressurePolicy policy)
+{
+	m_capacity = capacity;
+	m_policy = policy;
+	m_closed = false;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+FramePacket* FrameQueue::push(FramePacket* p_packet)
+{
+	FramePacket* p_recycle = NULL;
+	std::unique_lock<std::mutex> lock(m_mutex);
+
+	if (m_capacity > 0 && m_packets.size() >= m_capacity)
+	{
+		if (m_policy == BackPressurePolicy::DROP_OLDEST)
+		{
+			p_recycle = m_packets.front();
+			m_packets.pop_front();
+		}
+		else
+		{
+			m_notFull.wait(lock, [this] { return m_closed || m_packets.size() < m_capacity; });
+			if (m_closed)
+			{
+				return p_packet;
+			}
+		}
+	}
+
+	m_packets.push_back(p_packet);
+	lock.unlock();
+
+	m_notEmpty.notify_one();
+	return p_recycle;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+FramePacket* FrameQueue::pop()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+
+	m_notEmpty.wait(lock, [this] { return m_closed || !m_packets.empty(); });
+	if (m_packets.empty())
+	{
+		return NULL; // Closed
+	}
+
+	FramePacket* p_packet = m_packets.front();
+	m_packets.pop_front();
+	lock.unlock();
+
+	m_notFull.notify_one();
+	return p_packet;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+FramePacket* FrameQueue::tryPop()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+
+	if (m_packets.empty())
+	{
+		return NULL;
+	}
+
+	FramePacket* p_packet = m_packets.front();
+	m_packets.pop_front();
+	lock.unlock();
+
+	m_notFull.notify_one();
+	return p_packet;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void FrameQueue::close()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_closed = true;
+	}
+
+	m_notEmpty.notify_all();
+	m_notFull.notify_all();
+}
+
+
+//================================================================================//
+
+
+FramePipeline::FramePipeline(FramePool &framePool, unsigned int queueDepth, BackPressurePolicy policy)
+	: m_framePool(framePool), m_analysisQueue(queueDepth, policy), m_renderQueue(queueDepth, policy)
+{
+	m_running = false;
+	m_droppedFrames = 0;
+	mp_displayedPacket = NULL;
+
+	// One packet per queue slot, one in each stage, and one on screen.
+	unsigned int packetCount = 2 * queueDepth + 4;
+	m_framePool.reserve(m_framePool.getImageCount() + packetCount);
+	for (unsigned int i = 0; i < packetCount; i++)
+	{
+		FramePacket* p_packet = new FramePacket();
+		p_packet->p_image = m_framePool.acquire();
+		p_packet->p_luma = new LumaPlane(); // Sized by its first copyFrom()
+
+		m_packets.push_back(p_packet);
+		m_freePackets.push(p_packet);
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+FramePipeline::~FramePipeline()
+{
+	stop();
+
+	for (int i = 0; i < m_packets.size(); i++)
+	{
+		m_framePool.release(m_packets[i]->p_image);
+		delete m_packets[i]->p_luma;
+		delete m_packets[i];
+	}
+	m_packets.clear();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void FramePipeline::start(CaptureStage capture, AnalysisStage analysis)
+{
+	if (m_running)
+	{
+		return;
+	}
+
+	m_running = true;
+	m_captureThread = std::thread(&FramePipeline::captureLoop, this, capture);
+	m_analysisThread = std::thread(&FramePipeline::analysisLoop, this, analysis);
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void FramePipeline::stop()
+{
+	m_running = false;
+
+	m_freePackets.close();
+	m_analysisQueue.close();
+	m_renderQueue.close();
+
+	if (m_captureThread.joinable())
+	{
+		m_captureThread.join();
+	}
+	if (m_analysisThread.joinable())
+	{
+		m_analysisThread.join();
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+FramePacket* FramePipeline::acquireLatest()
+{
+	FramePacket* p_newest = NULL;
+	FramePacket* p_packet;
+
+	while ((p_packet = m_renderQueue.tryPop()) != NULL)
+	{
+		if (p_newest != NULL)
+		{
+			recycle(p_newest, true); // Finished, but already out of date
+		}
+		p_newest = p_packet;
+	}
+
+	if (p_newest == NULL)
+	{
+		return NULL;
+	}
+
+	if (mp_displayedPacket != NULL)
+	{
+		recycle(mp_displayedPacket, false);
+	}
+	mp_displayedPacket = p_newest;
+
+	return p_newest;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void FramePipeline::captureLoop(CaptureStage capture)
+{
+	unsigned long long sequence = 0;
+	FramePacket* p_packet;
+	FramePacket* p_recycle;
+
+	while (m_running && (p_packet = m_freePackets.pop()) != NULL)
+	{
+		if (!capture(*p_packet))
+		{
+			m_freePackets.push(p_packet);
+			std::this_thread::sleep_for(std::chrono::milliseconds(1)); // No new frame yet
+			continue;
+		}
+
+		p_packet->sequence = sequence++;
+
+		if ((p_recycle = m_analysisQueue.push(p_packet)) != NULL)
+		{
+			recycle(p_recycle, true);
+		}
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void FramePipeline::analysisLoop(AnalysisStage analysis)
+{
+	FramePacket* p_packet;
+	FramePacket* p_recycle;
+
+	while ((p_packet = m_analysisQueue.pop()) != NULL)
+	{
+		analysis(*p_packet);
+
+		if ((p_recycle = m_renderQueue.push(p_packet)) != NULL)
+		{
+			recycle(p_recycle, true);
+		}
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void FramePipeline::recycle(FramePacket* p_packet, bool dropped)
+{
+	if (dropped)
+	{
+		m_droppedFrames++;
+	}
+
+	m_freePackets.push(p_packet);
+}
+
+
+//================================================================================//
+
+
+BackPressurePolicy parseBackPressurePolicy(const std::string& text)
+{
+	std::string workingString = toLower(text);
+
+	if (workingString == "drop oldest") return BackPressurePolicy::DROP_OLDEST;
+	else if (workingString == "block") return BackPressurePolicy::BLOCK;
+
+	return BackPressurePolicy::INVALID; // If no correct policy is detected
+}
\ No newline at end of file
@@ -0,0 +1,189 @@
+//================================================================================//
+// FramePipeline
+//	- Staged frame processing across consecutive frames.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//--------------------------------------------------------------------------------//
+// NOTE: Frames move through three stages as FramePackets:
+//			1. Capture & detection	(pipeline thread)
+//			2. Sampling & estimation	(pipeline thread)
+//			3. Rendering				(caller's thread, through acquireLatest())
+//		 While frame N+1 is being detected, frame N is being sampled and frame
+//		 N-1 is on screen, so throughput is bounded by the slowest stage rather
+//		 than the sum of all of them. Packets are allocated once and recycled.
+//================================================================================//
+#pragma once
+
+#include<vector>
+#include<deque>
+#include<thread>
+#include<mutex>
+#include<condition_variable>
+#include<atomic>
+#include<functional>
+#include<chrono>
+#include<string>
+
+#include "TypeDef.hpp"
+#include "Texture.hpp"
+#include "FramePool.hpp"
+#include "ARMarker.hpp"
+#include "TrackingSnapshot.hpp"
+#include "LumaPlane.hpp"
+
+
+// ENUMERATIONS
+enum class BackPressurePolicy
+{
+	DROP_OLDEST,	// A full queue discards its oldest packet to make room.
+	BLOCK,			// A full queue makes the producing stage wait.
+	INVALID = -1	// Used as a default value for the function parseBackPressurePolicy
+};
+
+
+//--------------------------------------------------------------------------------//
+
+
+// Luminance sampled from one marker face.
+struct FaceSample
+{
+	int markerID;
+	float luminance;	// -1 if the face was not sampled
+	glm::vec4 normal;
+};
+
+
+// Everything known about one camera frame as it moves through the stages.
+struct FramePacket
+{
+	unsigned long long sequence;
+	unsigned long long frameSequence;					// Camera's sequence number of the frame
+	std::chrono::steady_clock::time_point timestamp;	// When the frame was captured
+	Image* p_image;					// Frame pixels; not owned by the packet
+	LumaPlane* p_luma;				// Luminance of p_image; not owned by the packet
+
+	// DETECTION RESULTS
+	TrackingSnapshot tracking;		// Copy of the snapshot published for the frame
+	ARPose worldPose;				// Pose of the "world" marker
+	ARPose dodecahedronPose;		// Best offset pose among the sampled faces
+
+	// SAMPLING RESULTS
+	std::vector<FaceSample> faces;
+	bool facesReplayed;				// Faces came from a recording; sampling is skipped.
+
+	// ESTIMATION RESULTS
+	bool lightEstimated;
+	glm::vec3 lightDirection;
+	float lightIntensity;
+	float ambientIntensity;
+
+	FramePacket();
+
+	// Result for the marker with the provided ID, or NULL.
+	inline const MarkerResult* findMarker(int markerID) const { return tracking.find(markerID); }
+
+	// Error of the marker with the provided ID, -1 if it is not valid.
+	inline float getMarkerError(int markerID) const { return tracking.getError(markerID); }
+};
+
+
+//--------------------------------------------------------------------------------//
+
+
+class FrameQueue
+{
+public:
+	// capacity: Maximum number of queued packets, 0 for unbounded.
+	FrameQueue(unsigned int capacity = 0, BackPressurePolicy policy = BackPressurePolicy::BLOCK);
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Adds a packet to the back of the queue.
+	// OUTPUT: Packet the caller must recycle: the evicted oldest packet
+	//		   (DROP_OLDEST), p_packet itself if the queue was closed while
+	//		   waiting (BLOCK), or NULL.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	FramePacket* push(FramePacket* p_packet);
+
+	// Waits for a packet. Returns NULL once the queue is closed.
+	FramePacket* pop();
+
+	// Returns NULL immediately if the queue is empty.
+	FramePacket* tryPop();
+
+	// Wakes every waiting thread; push() and pop() stop blocking.
+	void close();
+
+private:
+	std::deque<FramePacket*> m_packets;
+	std::mutex m_mutex;
+	std::condition_variable m_notEmpty;
+	std::condition_variable m_notFull;
+	unsigned int m_capacity;
+	BackPressurePolicy m_policy;
+	bool m_closed;
+};
+
+
+//--------------------------------------------------------------------------------//
+
+
+class FramePipeline
+{
+public:
+	// Fills a packet with a new frame, its capture time and its detection results.
+	// Returns false if no new frame was ready.
+	typedef std::function<bool(FramePacket&)> CaptureStage;
+	// Fills a packet with sampling and estimation results.
+	typedef std::function<void(FramePacket&)> AnalysisStage;
+
+	// Packet images come from framePool, which must outlive the pipeline.
+	FramePipeline(FramePool &framePool, unsigned int queueDepth = 1, BackPressurePolicy policy = BackPressurePolicy::DROP_OLDEST);
+	~FramePipeline();
+
+	void start(CaptureStage capture, AnalysisStage analysis);
+	void stop();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Render stage. Takes the newest fully processed packet.
+	// OUTPUT: Packet to render, or NULL if nothing new has finished. The
+	//		   packet stays valid until the next non-NULL return.
+	// NOTES: Older finished packets that were never rendered are dropped.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	FramePacket* acquireLatest();
+
+	inline unsigned long long getDroppedFrameCount() const { return m_droppedFrames; }
+	inline bool isRunning() const { return m_running; }
+
+private:
+	std::vector<FramePacket*> m_packets;	// Every packet; owns them and their luma planes.
+	FramePool &m_framePool;					// Lends the packets their images
+	FrameQueue m_freePackets;
+	FrameQueue m_analysisQueue;
+	FrameQueue m_renderQueue;
+	FramePacket* mp_displayedPacket;
+
+	std::thread m_captureThread;
+	std::thread m_analysisThread;
+	std::atomic<bool> m_running;
+	std::atomic<unsigned long long> m_droppedFrames;
+
+	void captureLoop(CaptureStage capture);
+	void analysisLoop(AnalysisStage analysis);
+
+	// Returns a packet to the free list, counting it as dropped if it was never rendered.
+	void recycle(FramePacket* p_packet, bool dropped);
+};
+
+
+//================================================================================//
+
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Utility function to help parse back-pressure policies from
+//				file contents.
+// OUTPUT: Matching BackPressurePolicy, or BackPressurePolicy::INVALID.
+// ARGUMENTS:
+//	- text: String to be interpreted as a policy (e.g. "drop oldest").
+//---------------------------------------------------------------------------//
+BackPressurePolicy parseBackPressurePolicy(const std::string& text);
\ No newline at end of file
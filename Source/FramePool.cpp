@@ -0,0 +1,116 @@
+//================================================================================//
+// FramePool
+//	- Recycles frame-sized images so steady-state processing allocates no
+//	  frame memory.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//================================================================================//
+#include "FramePool.hpp"
+
+#include "Telemetry.hpp"
+
+
+FramePool::FramePool(unsigned int width, unsigned int height, Image::ColorDepth depth, unsigned int rowAlignment)
+{
+	m_width = width;
+	m_height = height;
+	m_depth = depth;
+	m_rowAlignment = rowAlignment;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+FramePool::~FramePool()
+{
+	for (int i = 0; i < m_images.size(); i++)
+	{
+		delete m_images[i];
+	}
+	m_images.clear();
+	m_free.clear();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+Image* FramePool::acquire()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	if (m_free.empty())
+	{
+		return allocate();
+	}
+
+	Image* p_image = m_free.back();
+	m_free.pop_back();
+	return p_image;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void FramePool::release(Image* p_image)
+{
+	if (p_image == NULL)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_free.push_back(p_image);
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void FramePool::reserve(unsigned int count)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	while (m_images.size() < count)
+	{
+		m_free.push_back(allocate());
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+unsigned int FramePool::getImageCount()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_images.size();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+unsigned int FramePool::getFreeCount()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_free.size();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+Image* FramePool::allocate()
+{
+	Image* p_image = new Image(m_width, m_height, m_depth, m_rowAlignment);
+
+	m_images.push_back(p_image);
+	m_free.reserve(m_images.size()); // So release() never reallocates
+
+	getTelemetry().count(TelemetryCounter::FRAME_ALLOCATIONS);
+	return p_image;
+}
\ No newline at end of file
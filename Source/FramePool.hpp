@@ -0,0 +1,60 @@
+//================================================================================//
+// FramePool
+//	- Recycles frame-sized images so steady-state processing allocates no
+//	  frame memory.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//--------------------------------------------------------------------------------//
+// NOTE: Every image has the pool's dimensions, depth and stride, and starts on
+//		 a PIXEL_ALIGNMENT boundary. acquire() and release() lock, so images
+//		 can be taken on one thread and returned on another. The pool owns
+//		 every image it hands out and must outlive them.
+//================================================================================//
+#pragma once
+
+#include<vector>
+#include<mutex>
+
+#include "Texture.hpp"
+
+class FramePool
+{
+public:
+	// rowAlignment: Passed to every image; 0 packs rows for ARToolKit.
+	FramePool(unsigned int width, unsigned int height, Image::ColorDepth depth, unsigned int rowAlignment = 0);
+	~FramePool();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Takes a free image, allocating one only if none is free.
+	// OUTPUT: Image with undefined contents, owned by the pool.
+	// MUTATES:
+	//	- m_free, m_images (when it allocates)
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	Image* acquire();
+
+	// Returns an image taken with acquire(). NULL is ignored.
+	void release(Image* p_image);
+
+	// Allocates up front until the pool holds at least count images.
+	void reserve(unsigned int count);
+
+	// GETTERS
+	inline unsigned int getWidth() const { return m_width; }
+	inline unsigned int getHeight() const { return m_height; }
+	inline Image::ColorDepth getColorDepth() const { return m_depth; }
+	unsigned int getImageCount();
+	unsigned int getFreeCount();
+
+private:
+	std::vector<Image*> m_images;	// Every image the pool has allocated
+	std::vector<Image*> m_free;
+	std::mutex m_mutex;
+	unsigned int m_width;
+	unsigned int m_height;
+	Image::ColorDepth m_depth;
+	unsigned int m_rowAlignment;
+
+	// Call with m_mutex held.
+	Image* allocate();
+};
\ No newline at end of file
@@ -0,0 +1,67 @@
+//================================================================================//
+// FrameRing
+//	- Lock-free triple buffer of camera frames shared by one producer (the
+//	  capture thread) and one consumer (the processing loop).
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//================================================================================//
+#include "FrameRing.hpp"
+
+
+FrameRing::FrameRing(FramePool &framePool)
+	: m_framePool(framePool)
+{
+	for (int i = 0; i < 3; i++)
+	{
+		mp_buffers[i] = m_framePool.acquire();
+		m_sequences[i] = 0;
+	}
+
+	m_front = 0;
+	m_middle = 1;
+	m_back = 2;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+FrameRing::~FrameRing()
+{
+	for (int i = 0; i < 3; i++)
+	{
+		m_framePool.release(mp_buffers[i]);
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void FrameRing::publish(unsigned long long sequence, std::chrono::steady_clock::time_point timestamp)
+{
+	m_sequences[m_back] = sequence;
+	m_timestamps[m_back] = timestamp;
+
+	// Release: the frame's pixels must be visible before its index is.
+	unsigned int previous = m_middle.exchange(m_back | m_FRESH_BIT, std::memory_order_acq_rel);
+	m_back = previous & m_INDEX_MASK;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool FrameRing::acquireLatest()
+{
+	if ((m_middle.load(std::memory_order_relaxed) & m_FRESH_BIT) == 0)
+	{
+		return false; // Nothing new since the last call.
+	}
+
+	unsigned int previous = m_middle.exchange(m_front, std::memory_order_acq_rel);
+	m_front = previous & m_INDEX_MASK;
+
+	return true;
+}
\ No newline at end of file
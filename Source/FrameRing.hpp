@@ -0,0 +1,74 @@
+//================================================================================//
+// FrameRing
+//	- Lock-free triple buffer of camera frames shared by one producer (the
+//	  capture thread) and one consumer (the processing loop).
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//--------------------------------------------------------------------------------//
+// NOTE: The producer always owns one buffer and the consumer always owns one.
+//		 The third buffer is handed between them with a single atomic exchange,
+//		 so neither side ever waits for the other and the consumer never sees a
+//		 partially written frame.
+//================================================================================//
+#pragma once
+
+#include<atomic>
+#include<chrono>
+
+#include "Texture.hpp"
+#include "FramePool.hpp"
+
+class FrameRing
+{
+public:
+	// Takes its three buffers from framePool, which must outlive the ring.
+	FrameRing(FramePool &framePool);
+	~FrameRing();
+
+	// PRODUCER SIDE
+
+	// Buffer the producer may write into. Only valid until publish() is called.
+	inline Image* getWriteBuffer() { return mp_buffers[m_back]; }
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Makes the write buffer the newest complete frame and
+	//				takes the previously published buffer back for writing.
+	// INPUT:
+	//	- sequence, timestamp: Identify the frame; read back with
+	//						   getReadSequence() and getReadTimestamp().
+	// MUTATES:
+	//	- m_middle, m_back
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void publish(unsigned long long sequence = 0,
+		std::chrono::steady_clock::time_point timestamp = std::chrono::steady_clock::time_point());
+
+
+	// CONSUMER SIDE
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Takes the newest published frame, if there is one the
+	//				consumer has not already seen.
+	// OUTPUT: True if the read buffer now holds a new frame.
+	// MUTATES:
+	//	- m_middle, m_front
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool acquireLatest();
+
+	// Buffer the consumer may read from. Stays valid until acquireLatest() succeeds again.
+	inline Image* getReadBuffer() { return mp_buffers[m_front]; }
+	inline unsigned long long getReadSequence() const { return m_sequences[m_front]; }
+	inline std::chrono::steady_clock::time_point getReadTimestamp() const { return m_timestamps[m_front]; }
+
+private:
+	static const unsigned int m_FRESH_BIT = 0x4;	// Set while the middle buffer has not been consumed.
+	static const unsigned int m_INDEX_MASK = 0x3;
+
+	FramePool &m_framePool;
+	Image* mp_buffers[3];
+	unsigned long long m_sequences[3];	// Travel with their buffers
+	std::chrono::steady_clock::time_point m_timestamps[3];
+	std::atomic<unsigned int> m_middle;	// Index of the shared buffer, plus m_FRESH_BIT.
+	unsigned int m_back;				// Producer's buffer
+	unsigned int m_front;				// Consumer's buffer
+};
\ No newline at end of file
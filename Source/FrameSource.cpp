@@ -0,0 +1,199 @@
+//================================================================================//
+// FrameSource
+//	- Abstract source of video frames used by ARCamera.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//================================================================================//
+#include "FrameSource.hpp"
+
+#include "Parsing.h"
+
+#include <thread>
+
+
+FrameSource::FrameSource()
+{
+	m_width = -1;
+	m_height = -1;
+	m_pixelFormat = AR_PIXEL_FORMAT_INVALID;
+	m_playbackMode = PlaybackMode::REAL_TIME;
+	m_frameSequence = 0;
+	m_frameTimestamp = std::chrono::steady_clock::now();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool FrameSource::waitForFrame(unsigned int timeoutMilliseconds)
+{
+	std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMilliseconds < 1 ? timeoutMilliseconds : 1));
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void FrameSource::markNewFrame()
+{
+	m_frameSequence++;
+	m_frameTimestamp = std::chrono::steady_clock::now();
+}
+
+
+//================================================================================//
+
+
+ARVideoFrameSource::ARVideoFrameSource(const std::string &videoConfig)
+{
+	m_videoConfig = videoConfig;
+	m_open = false;
+	mp_lastImage = NULL;
+	m_lastFingerprint = 0;
+	m_frameSize = 0;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+ARVideoFrameSource::~ARVideoFrameSource()
+{
+	close();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool ARVideoFrameSource::open()
+{
+	if (arVideoOpen(m_videoConfig.c_str()) < 0)
+	{
+		return false;
+	}
+	m_open = true;
+
+	// Failures here are reported by ARCamera through the width, height, and format.
+	if (arVideoGetSize(&m_width, &m_height) < 0)
+	{
+		m_width = m_height = -1;
+	}
+	m_pixelFormat = arVideoGetPixelFormat();
+
+	if (m_width > 0 && m_height > 0 && m_pixelFormat != AR_PIXEL_FORMAT_INVALID)
+	{
+		m_frameSize = (size_t)m_width * m_height * arUtilGetPixelSize(m_pixelFormat);
+	}
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARVideoFrameSource::close()
+{
+	if (m_open)
+	{
+		arVideoClose();
+		m_open = false;
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool ARVideoFrameSource::startCapture()
+{
+	return (arVideoCapStart() == 0);
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ARVideoFrameSource::stopCapture()
+{
+	arVideoCapStop();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+ARUint8* ARVideoFrameSource::getImage()
+{
+	ARUint8* p_image = arVideoGetImage();
+	if (p_image == NULL)
+	{
+		return NULL;
+	}
+
+	unsigned long long imageFingerprint = fingerprint(p_image);
+	if (p_image != mp_lastImage || imageFingerprint != m_lastFingerprint)
+	{
+		markNewFrame();
+	}
+
+	mp_lastImage = p_image;
+	m_lastFingerprint = imageFingerprint;
+	return p_image;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+unsigned long long ARVideoFrameSource::fingerprint(const ARUint8* p_image) const
+{
+	const size_t SAMPLES = 1024;
+
+	// FNV-1a over evenly spaced bytes; sensor noise changes it between real frames.
+	unsigned long long hash = 14695981039346656037ULL;
+	size_t step = (m_frameSize > SAMPLES) ? m_frameSize / SAMPLES : 1;
+	for (size_t i = 0; i < m_frameSize; i += step)
+	{
+		hash = (hash ^ p_image[i]) * 1099511628211ULL;
+	}
+
+	return hash;
+}
+
+
+//================================================================================//
+
+
+AR_PIXEL_FORMAT parsePixelFormat(const std::string& text)
+{
+	std::string workingString = toLower(text);
+
+	if (workingString == "rgb") return AR_PIXEL_FORMAT_RGB;
+	else if (workingString == "bgr") return AR_PIXEL_FORMAT_BGR;
+	else if (workingString == "rgba") return AR_PIXEL_FORMAT_RGBA;
+	else if (workingString == "bgra") return AR_PIXEL_FORMAT_BGRA;
+	else if (workingString == "abgr") return AR_PIXEL_FORMAT_ABGR;
+	else if (workingString == "argb") return AR_PIXEL_FORMAT_ARGB;
+	else if (workingString == "mono") return AR_PIXEL_FORMAT_MONO;
+
+	return AR_PIXEL_FORMAT_INVALID; // If no correct pixel format is detected
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+PlaybackMode parsePlaybackMode(const std::string& text)
+{
+	std::string workingString = toLower(text);
+
+	if (workingString == "real time") return PlaybackMode::REAL_TIME;
+	else if (workingString == "max speed") return PlaybackMode::MAX_SPEED;
+	else if (workingString == "single step") return PlaybackMode::SINGLE_STEP;
+
+	return PlaybackMode::INVALID; // If no correct playback mode is detected
+}
\ No newline at end of file
@@ -0,0 +1,146 @@
+//================================================================================//
+// FrameSource
+//	- Abstract source of video frames used by ARCamera.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//--------------------------------------------------------------------------------//
+// NOTE: The interface deliberately mirrors the arVideo* functions so that a live
+//		 camera, a recording, or any other producer can sit behind ARCamera
+//		 without the rest of the pipeline knowing the difference.
+//================================================================================//
+#pragma once
+
+#include<AR/ar.h>
+#include<AR/video.h>
+#include<string>
+#include<chrono>
+
+#include "TypeDef.hpp"
+
+
+// ENUMERATIONS
+enum class PlaybackMode
+{
+	REAL_TIME,		// Frames are delivered at the source's nominal frame rate.
+	MAX_SPEED,		// A new frame is delivered every time one is requested.
+	SINGLE_STEP,	// A new frame is delivered only after step() is called.
+	INVALID = -1	// Used as a default value for the function parsePlaybackMode
+};
+
+
+
+class FrameSource
+{
+public:
+	FrameSource();
+	virtual ~FrameSource() {}
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Opens the source and determines its frame dimensions
+	//				and pixel format.
+	// MUTATES:
+	//	- m_width, m_height, m_pixelFormat
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual bool open() = 0;
+	virtual void close() = 0;
+
+	virtual bool startCapture() = 0;
+	virtual void stopCapture() = 0;
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Returns the newest frame, or NULL if no new frame is
+	//				available yet (same contract as arVideoGetImage()).
+	//				The buffer stays valid until the next call.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual ARUint8* getImage() = 0;
+
+	// Advances one frame when in PlaybackMode::SINGLE_STEP. Live sources ignore it.
+	virtual void step() {}
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Blocks until getImage() may have a new frame, or the
+	//				timeout passes. Used by the capture thread between
+	//				polls.
+	// OUTPUT: True if a frame is likely available.
+	// NOTES: The default sleeps for a millisecond; sources that can be
+	//		  notified of new frames override it.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual bool waitForFrame(unsigned int timeoutMilliseconds);
+
+	// GETTERS AND SETTERS
+	inline int getWidth() const { return m_width; }
+	inline int getHeight() const { return m_height; }
+	inline AR_PIXEL_FORMAT getPixelFormat() const { return m_pixelFormat; }
+	inline PlaybackMode getPlaybackMode() const { return m_playbackMode; }
+
+	// Sequence number and capture time of the frame last returned by getImage(). The
+	// sequence only advances for frames the source has not returned before.
+	inline unsigned long long getFrameSequence() const { return m_frameSequence; }
+	inline std::chrono::steady_clock::time_point getFrameTimestamp() const { return m_frameTimestamp; }
+
+protected:
+	int m_width;
+	int m_height;
+	AR_PIXEL_FORMAT m_pixelFormat;
+	PlaybackMode m_playbackMode;
+	unsigned long long m_frameSequence;
+	std::chrono::steady_clock::time_point m_frameTimestamp;
+
+	// Called by getImage() when it returns a frame it has not returned before.
+	void markNewFrame();
+};
+
+
+//--------------------------------------------------------------------------------//
+
+
+class ARVideoFrameSource : public FrameSource
+{
+public:
+	ARVideoFrameSource(const std::string &videoConfig = "");
+	~ARVideoFrameSource();
+
+	bool open();
+	void close();
+
+	bool startCapture();
+	void stopCapture();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Returns arVideoGetImage()'s frame.
+	// NOTES: Some video modules return the last buffer again until the
+	//		  camera fills a new one. A frame is only treated as new if its
+	//		  buffer or a sparse fingerprint of its contents has changed.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	ARUint8* getImage();
+
+private:
+	std::string m_videoConfig;
+	bool m_open;
+	ARUint8* mp_lastImage;				// Buffer returned by the last getImage()
+	unsigned long long m_lastFingerprint;
+	size_t m_frameSize;					// Bytes per frame
+
+	unsigned long long fingerprint(const ARUint8* p_image) const;
+};
+
+
+//================================================================================//
+
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Utility function to help parse pixel formats from file contents.
+// OUTPUT: Matching AR_PIXEL_FORMAT, or AR_PIXEL_FORMAT_INVALID.
+// ARGUMENTS:
+//	- text: String to be interpreted as a pixel format (e.g. "bgra").
+//---------------------------------------------------------------------------//
+AR_PIXEL_FORMAT parsePixelFormat(const std::string& text);
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Utility function to help parse playback modes from file contents.
+// OUTPUT: Matching PlaybackMode, or PlaybackMode::INVALID.
+// ARGUMENTS:
+//	- text: String to be interpreted as a playback mode (e.g. "max speed").
+//---------------------------------------------------------------------------//
+PlaybackMode parsePlaybackMode(const std::string& text);
\ No newline at end of file
@@ -0,0 +1,343 @@
+//================================================================================//
+// LabelingEngine
+//	- Thresholds a luma plane into a bit mask and labels its dark connected
+//	  components by runs, in parallel row bands, fitting square marker
+//	  candidates to them.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//================================================================================//
+#include "LabelingEngine.hpp"
+
+#include <AR/ar.h>
+#include <algorithm>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define LABELING_X86
+#include <emmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+
+//================================================================================//
+// BIT AND UNION-FIND HELPERS
+//================================================================================//
+
+static inline int countTrailingZeros(uint64_t bits)
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+	unsigned long index;
+	_BitScanForward64(&index, bits);
+	return (int)index;
+#elif defined(_MSC_VER)
+	unsigned long index;
+	if (_BitScanForward(&index, (unsigned long)bits))
+	{
+		return (int)index;
+	}
+	_BitScanForward(&index, (unsigned long)(bits >> 32));
+	return (int)index + 32;
+#else
+	return __builtin_ctzll(bits);
+#endif
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+// First pixel at or after x whose mask bit is set (or clear), or width if there is none.
+static int findBit(const uint64_t* p_row, int words, int width, int x, bool set)
+{
+	int word = x >> 6;
+	if (word >= words)
+	{
+		return width;
+	}
+
+	uint64_t bits = (set ? p_row[word] : ~p_row[word]) & (~0ULL << (x & 63));
+	while (bits == 0)
+	{
+		if (++word >= words)
+		{
+			return width;
+		}
+		bits = set ? p_row[word] : ~p_row[word];
+	}
+
+	return std::min((word << 6) + countTrailingZeros(bits), width);
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+static int findRoot(std::vector<int> &parent, int run)
+{
+	while (parent[run] != run)
+	{
+		parent[run] = parent[parent[run]]; // Path halving
+		run = parent[run];
+	}
+	return run;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+// The lower index becomes the root, so roots stay in scan order.
+static void joinRuns(std::vector<int> &parent, int a, int b)
+{
+	a = findRoot(parent, a);
+	b = findRoot(parent, b);
+	if (a < b)
+	{
+		parent[b] = a;
+	}
+	else if (b < a)
+	{
+		parent[a] = b;
+	}
+}
+
+
+//================================================================================//
+
+
+LabelingEngine::LabelingEngine()
+{
+	m_width = 0;
+	m_height = 0;
+	m_maskWords = 0;
+	m_minArea = AR_AREA_MIN;
+	m_maxArea = AR_AREA_MAX;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool LabelingEngine::init(int width, int height, unsigned int bandCount)
+{
+	if (width < 3 || height < 3)
+	{
+		return false;
+	}
+
+	m_width = width;
+	m_height = height;
+	m_maskWords = (width + 63) / 64;
+	m_mask.assign((size_t)m_maskWords * height, 0);
+
+	bandCount = std::max(1u, std::min(bandCount, (unsigned int)height));
+	m_bands.assign(bandCount, Band());
+	for (unsigned int i = 0; i < bandCount; i++)
+	{
+		m_bands[i].top = (int)((long long)height * i / bandCount);
+		m_bands[i].bottom = (int)((long long)height * (i + 1) / bandCount);
+	}
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void LabelingEngine::thresholdRow(const ubyte* p_row, uint64_t* p_mask, int threshold) const
+{
+	int x = 0;
+
+#ifdef LABELING_X86
+	// min(v, t) == v exactly when v <= t, which SSE2 can test on unsigned bytes.
+	const __m128i limit = _mm_set1_epi8((char)threshold);
+	for (; x + 64 <= m_width; x += 64)
+	{
+		uint64_t bits = 0;
+		for (int i = 0; i < 4; i++)
+		{
+			__m128i pixels = _mm_loadu_si128((const __m128i*)(p_row + x + 16 * i));
+			__m128i dark = _mm_cmpeq_epi8(_mm_min_epu8(pixels, limit), pixels);
+			bits |= (uint64_t)(uint16_t)_mm_movemask_epi8(dark) << (16 * i);
+		}
+		p_mask[x >> 6] = bits;
+	}
+#endif
+
+	// The rest of the row, leaving the bits past the width clear.
+	for (; x < m_width; x += 64)
+	{
+		uint64_t bits = 0;
+		int end = std::min(x + 64, m_width);
+		for (int i = x; i < end; i++)
+		{
+			bits |= (uint64_t)(p_row[i] <= threshold) << (i - x);
+		}
+		p_mask[x >> 6] = bits;
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void LabelingEngine::labelBand(unsigned int bandIndex, const ubyte* p_pixels, int threshold)
+{
+	Band &band = m_bands[bandIndex];
+	band.runs.clear();
+	band.parent.clear();
+	band.firstRowEnd = band.lastRowStart = 0;
+
+	threshold = std::min(std::max(threshold, 0), 255);
+	int rowStart = 0, previousRowStart = 0;
+
+	for (int y = band.top; y < band.bottom; y++)
+	{
+		uint64_t* p_mask = &m_mask[(size_t)y * m_maskWords];
+		thresholdRow(p_pixels + (size_t)y * m_width, p_mask, threshold);
+
+		// RUNS OF THE ROW
+		rowStart = (int)band.runs.size();
+		for (int x = findBit(p_mask, m_maskWords, m_width, 0, true); x < m_width; )
+		{
+			int end = findBit(p_mask, m_maskWords, m_width, x, false);
+			Run run = { x, end - 1, y };
+			band.runs.push_back(run);
+			band.parent.push_back((int)band.parent.size());
+			x = findBit(p_mask, m_maskWords, m_width, end, true);
+		}
+
+		if (y == band.top)
+		{
+			band.firstRowEnd = (int)band.runs.size();
+		}
+		else
+		{
+			joinRows(band.parent, band.runs, previousRowStart, rowStart, 0, band.runs, rowStart, (int)band.runs.size(), 0);
+		}
+		previousRowStart = rowStart;
+	}
+
+	band.lastRowStart = rowStart;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void LabelingEngine::mergeBands(std::vector<ComponentQuad> &quads)
+{
+	quads.clear();
+
+	// ONE UNION-FIND OVER EVERY BAND, with each band's runs after the previous band's
+	std::vector<int> offsets(m_bands.size());
+	int runCount = 0;
+	for (int b = 0; b < m_bands.size(); b++)
+	{
+		offsets[b] = runCount;
+		runCount += (int)m_bands[b].runs.size();
+	}
+
+	m_parent.resize(runCount);
+	for (int b = 0; b < m_bands.size(); b++)
+	{
+		Band &band = m_bands[b];
+		for (int i = 0; i < band.runs.size(); i++)
+		{
+			m_parent[offsets[b] + i] = offsets[b] + findRoot(band.parent, i);
+		}
+	}
+
+	// Runs on either side of each band boundary
+	for (int b = 1; b < m_bands.size(); b++)
+	{
+		const Band &upper = m_bands[b - 1];
+		const Band &lower = m_bands[b];
+		if (upper.runs.empty() || lower.runs.empty()) continue;
+
+		joinRows(m_parent, upper.runs, upper.lastRowStart, (int)upper.runs.size(), offsets[b - 1],
+			lower.runs, 0, lower.firstRowEnd, offsets[b]);
+	}
+
+	// COMPONENTS
+	m_componentOf.assign(runCount, -1);
+	m_components.clear();
+	for (int b = 0; b < m_bands.size(); b++)
+	{
+		const Band &band = m_bands[b];
+		for (int i = 0; i < band.runs.size(); i++)
+		{
+			int root = findRoot(m_parent, offsets[b] + i);
+			if (m_componentOf[root] < 0)
+			{
+				m_componentOf[root] = (int)m_components.size();
+				m_components.push_back(ComponentExtremes());
+				resetExtremes(m_components.back());
+			}
+
+			const Run &run = band.runs[i];
+			addRunToExtremes(m_components[m_componentOf[root]], run.x0, run.x1, run.y);
+		}
+	}
+
+	for (const ComponentExtremes &component : m_components)
+	{
+		ComponentQuad quad;
+		if (component.area >= m_minArea && component.area <= m_maxArea
+			&& fitComponentQuad(component, m_width, m_height, m_minArea, quad))
+		{
+			quads.push_back(quad);
+		}
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void LabelingEngine::detect(const ubyte* p_pixels, int threshold, ThreadPool* p_pool, std::vector<ComponentQuad> &quads)
+{
+	unsigned int bandCount = getBandCount();
+	if (p_pool != nullptr && bandCount > 1)
+	{
+		p_pool->run(bandCount, [&](unsigned int band) { labelBand(band, p_pixels, threshold); });
+	}
+	else
+	{
+		for (unsigned int band = 0; band < bandCount; band++)
+		{
+			labelBand(band, p_pixels, threshold);
+		}
+	}
+
+	mergeBands(quads);
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void LabelingEngine::joinRows(std::vector<int> &parent, const std::vector<Run> &upperRuns, int upperStart, int upperEnd, int upperOffset,
+	const std::vector<Run> &lowerRuns, int lowerStart, int lowerEnd, int lowerOffset)
+{
+	// Both rows are sorted by x, so one sweep finds every touching pair.
+	int upper = upperStart;
+	for (int lower = lowerStart; lower < lowerEnd; lower++)
+	{
+		const Run &run = lowerRuns[lower];
+
+		while (upper < upperEnd && upperRuns[upper].x1 < run.x0 - 1)
+		{
+			upper++;
+		}
+
+		for (int i = upper; i < upperEnd && upperRuns[i].x0 <= run.x1 + 1; i++)
+		{
+			joinRuns(parent, upperOffset + i, lowerOffset + lower);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+//================================================================================//
+// LabelingEngine
+//	- Thresholds a luma plane into a bit mask and labels its dark connected
+//	  components by runs, in parallel row bands, fitting square marker
+//	  candidates to them.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//--------------------------------------------------------------------------------//
+// NOTE: labelBand() thresholds its rows 16 pixels at a time with SSE2 into
+//		 one bit per pixel. It then splits each row into runs of dark pixels
+//		 and joins runs that touch runs of the row above (8-connected), using
+//		 union-find on run indices. Bands are independent, so they can be
+//		 labeled concurrently. mergeBands() then joins the runs across each
+//		 band boundary and gathers every component's extremes for
+//		 fitComponentQuad().
+//		 Components match what ARToolKit labels at the same threshold:
+//		 pixels at or below it are dark, and components touching the border
+//		 are skipped.
+//================================================================================//
+#pragma once
+
+#include<vector>
+#include<cstdint>
+
+#include "TypeDef.hpp"
+#include "MarkerCandidates.hpp"
+#include "ThreadPool.hpp"
+
+class LabelingEngine
+{
+public:
+	LabelingEngine();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Sizes the engine for width x height planes labeled in
+	//				bandCount row bands.
+	// OUTPUT: False if the plane is too small to label.
+	// MUTATES:
+	//	- m_bands, m_mask
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool init(int width, int height, unsigned int bandCount);
+
+	// Thresholds and labels one band of the plane. Different bands may be labeled
+	// concurrently; mergeBands() runs once all of them have finished.
+	void labelBand(unsigned int band, const ubyte* p_pixels, int threshold);
+	void mergeBands(std::vector<ComponentQuad> &quads);
+
+	// Labels every band, on p_pool when given, and merges them.
+	void detect(const ubyte* p_pixels, int threshold, ThreadPool* p_pool, std::vector<ComponentQuad> &quads);
+
+	// Components outside [minArea, maxArea] pixels are not fitted.
+	inline void setAreaLimits(int minArea, int maxArea) { m_minArea = minArea; m_maxArea = maxArea; }
+
+	// GETTERS
+	inline unsigned int getBandCount() const { return (unsigned int)m_bands.size(); }
+	inline int getWidth() const { return m_width; }
+	inline int getHeight() const { return m_height; }
+
+private:
+	struct Run
+	{
+		int x0;		// First dark pixel
+		int x1;		// Last dark pixel
+		int y;
+	};
+
+	struct Band
+	{
+		int top;					// First row
+		int bottom;					// One past the last row
+		std::vector<Run> runs;		// In row order
+		std::vector<int> parent;	// Union-find over runs, in band indices
+		int firstRowEnd;			// Runs of the first row are [0, firstRowEnd)
+		int lastRowStart;			// Runs of the last row are [lastRowStart, runs.size())
+	};
+
+	int m_width;
+	int m_height;
+	int m_maskWords;				// 64-bit words per mask row
+	int m_minArea;
+	int m_maxArea;
+	std::vector<uint64_t> m_mask;	// One bit per pixel, set where dark
+	std::vector<Band> m_bands;
+
+	std::vector<int> m_parent;		// Union-find over every band's runs
+	std::vector<int> m_componentOf;	// Per root run: index into m_components, or -1
+	std::vector<ComponentExtremes> m_components;
+
+	void thresholdRow(const ubyte* p_row, uint64_t* p_mask, int threshold) const;
+
+	// Joins runs [lowerStart, lowerEnd) of one row to runs [upperStart, upperEnd) of the row above
+	// that they touch, diagonals included. Union-find indices are run indices plus the offsets.
+	static void joinRows(std::vector<int> &parent, const std::vector<Run> &upperRuns, int upperStart, int upperEnd, int upperOffset,
+		const std::vector<Run> &lowerRuns, int lowerStart, int lowerEnd, int lowerOffset);
+};
\ No newline at end of file
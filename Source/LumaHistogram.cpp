@@ -0,0 +1,188 @@
+//================================================================================//
+// LumaHistogram
+//	- 256-bin histogram of a luma plane region, and the binarisation
+//	  thresholds chosen from it.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//================================================================================//
+#include "LumaHistogram.hpp"
+
+#include <cstring>
+#include <algorithm>
+
+
+LumaHistogram::LumaHistogram()
+{
+	memset(m_bins, 0, sizeof(m_bins));
+	m_total = 0;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void LumaHistogram::build(const ubyte* p_pixels, unsigned int width, unsigned int height,
+	int x, int y, int regionWidth, int regionHeight, unsigned int rowStep)
+{
+	int left = std::max(x, 0);
+	int top = std::max(y, 0);
+	int right = std::min(x + regionWidth, (int)width);
+	int bottom = std::min(y + regionHeight, (int)height);
+	rowStep = (rowStep < 1) ? 1 : rowStep;
+
+	// Neighbouring pixels are often equal, so four sub-histograms keep increments of the
+	// same bin from waiting on each other. Pixels are read eight at a time.
+	uint32_t counts[4][256];
+	memset(counts, 0, sizeof(counts));
+
+	for (int row = top; row < bottom; row += rowStep)
+	{
+		const ubyte* p_row = p_pixels + (size_t)row * width;
+		int column = left;
+
+		for (; column + 8 <= right; column += 8)
+		{
+			uint64_t word;
+			memcpy(&word, p_row + column, sizeof(word));
+
+			counts[0][word & 0xFF]++;
+			counts[1][(word >> 8) & 0xFF]++;
+			counts[2][(word >> 16) & 0xFF]++;
+			counts[3][(word >> 24) & 0xFF]++;
+			counts[0][(word >> 32) & 0xFF]++;
+			counts[1][(word >> 40) & 0xFF]++;
+			counts[2][(word >> 48) & 0xFF]++;
+			counts[3][word >> 56]++;
+		}
+
+		for (; column < right; column++)
+		{
+			counts[0][p_row[column]]++;
+		}
+	}
+
+	m_total = 0;
+	for (int i = 0; i < 256; i++)
+	{
+		m_bins[i] = counts[0][i] + counts[1][i] + counts[2][i] + counts[3][i];
+		m_total += m_bins[i];
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+int LumaHistogram::otsu() const
+{
+	if (m_total == 0)
+	{
+		return -1;
+	}
+
+	double sum = 0.0;
+	for (int i = 0; i < 256; i++)
+	{
+		sum += (double)i * m_bins[i];
+	}
+
+	double darkCount = 0.0, darkSum = 0.0;
+	double bestVariance = -1.0;
+	int best = 0;
+
+	for (int t = 0; t < 255; t++)
+	{
+		darkCount += m_bins[t];
+		darkSum += (double)t * m_bins[t];
+
+		double lightCount = (double)m_total - darkCount;
+		if (darkCount == 0.0 || lightCount == 0.0) continue;
+
+		// Between-class variance, up to a constant factor.
+		double difference = darkSum / darkCount - (sum - darkSum) / lightCount;
+		double variance = darkCount * lightCount * difference * difference;
+		if (variance > bestVariance)
+		{
+			bestVariance = variance;
+			best = t;
+		}
+	}
+
+	return best;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool LumaHistogram::multiOtsu(int &low, int &high) const
+{
+	if (m_total == 0)
+	{
+		return false;
+	}
+
+	// Cumulative counts and sums, so each class's moments are two subtractions.
+	double counts[257], sums[257];
+	counts[0] = sums[0] = 0.0;
+	for (int i = 0; i < 256; i++)
+	{
+		counts[i + 1] = counts[i] + m_bins[i];
+		sums[i + 1] = sums[i] + (double)i * m_bins[i];
+	}
+
+	// Maximizing the sum of n * mean^2 over the classes maximizes the between-class variance.
+	double bestScore = -1.0;
+	low = 0;
+	high = 1;
+
+	for (int t1 = 0; t1 < 254; t1++)
+	{
+		double n0 = counts[t1 + 1], s0 = sums[t1 + 1];
+		double score0 = (n0 > 0.0) ? s0 * s0 / n0 : 0.0;
+
+		for (int t2 = t1 + 1; t2 < 255; t2++)
+		{
+			double n1 = counts[t2 + 1] - n0, s1 = sums[t2 + 1] - s0;
+			double n2 = counts[256] - counts[t2 + 1], s2 = sums[256] - sums[t2 + 1];
+
+			double score = score0 + ((n1 > 0.0) ? s1 * s1 / n1 : 0.0) + ((n2 > 0.0) ? s2 * s2 / n2 : 0.0);
+			if (score > bestScore)
+			{
+				bestScore = score;
+				low = t1;
+				high = t2;
+			}
+		}
+	}
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+int LumaHistogram::percentile(float fraction) const
+{
+	if (m_total == 0)
+	{
+		return -1;
+	}
+
+	fraction = std::min(std::max(fraction, 0.0f), 1.0f);
+	uint64_t target = (uint64_t)(fraction * (double)m_total);
+	uint64_t cumulative = 0;
+
+	for (int i = 0; i < 256; i++)
+	{
+		cumulative += m_bins[i];
+		if (cumulative >= target && cumulative > 0)
+		{
+			return i;
+		}
+	}
+
+	return 255;
+}
\ No newline at end of file
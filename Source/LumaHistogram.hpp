@@ -0,0 +1,65 @@
+//================================================================================//
+// LumaHistogram
+//	- 256-bin histogram of a luma plane region, and the binarisation
+//	  thresholds chosen from it.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//--------------------------------------------------------------------------------//
+// NOTE: Thresholds follow ARToolKit's labeling: pixels at or below the
+//		 threshold are dark. Built once per frame from LumaPlane, so every
+//		 detection pass can share it.
+//================================================================================//
+#pragma once
+
+#include<cstdint>
+
+#include "TypeDef.hpp"
+
+
+enum class ThresholdMode
+{
+	MANUAL,			// Base threshold plus pass increments
+	OTSU,			// One threshold maximizing the between-class variance
+	MULTI_OTSU,		// Two thresholds splitting dark, mid and light
+	PERCENTILE		// Midpoint of the dark and light percentiles
+};
+
+
+class LumaHistogram
+{
+public:
+	LumaHistogram();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Counts the pixels of a region of a plane, replacing the
+	//				previous counts.
+	// INPUT:
+	//	* p_pixels: Plane of width * height bytes.
+	//	* x, y, regionWidth, regionHeight: Region to count; clipped to the
+	//	  plane.
+	//	* rowStep: Counts every rowStep-th row; 2 halves the cost and
+	//	  barely moves the thresholds.
+	// MUTATES:
+	//	- m_bins, m_total
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void build(const ubyte* p_pixels, unsigned int width, unsigned int height,
+		int x, int y, int regionWidth, int regionHeight, unsigned int rowStep = 1);
+
+	// Otsu's threshold, or -1 if the histogram is empty.
+	int otsu() const;
+
+	// Two thresholds (low < high) maximizing the variance between three classes. False if the histogram is empty.
+	bool multiOtsu(int &low, int &high) const;
+
+	// Smallest value with at least fraction [0, 1] of the pixels at or below it, or -1 if the histogram is empty.
+	int percentile(float fraction) const;
+
+	// GETTERS
+	inline uint32_t getBin(int value) const { return m_bins[value]; }
+	inline uint64_t getTotal() const { return m_total; }
+
+private:
+	uint32_t m_bins[256];
+	uint64_t m_total;
+};
\ No newline at end of file
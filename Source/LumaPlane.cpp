@@ -0,0 +1,436 @@
+//================================================================================//
+// LumaPlane
+//	- 8-bit luminance plane extracted once per camera frame.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//================================================================================//
+#include "LumaPlane.hpp"
+
+#include <cstring>
+
+#include "Util.hpp"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define LUMA_X86
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define LUMA_TARGET_SSSE3
+#else
+#define LUMA_TARGET_SSSE3 __attribute__((target("ssse3")))
+#endif
+#endif
+
+
+// glm::luminosity() weights (0.33, 0.59, 0.11), rescaled to sum to 256.
+static const short LUMA_WEIGHT_R = 82;
+static const short LUMA_WEIGHT_G = 147;
+static const short LUMA_WEIGHT_B = 27;
+
+
+//================================================================================//
+// CONVERSION KERNELS
+//================================================================================//
+
+// Weight of each byte of a packed pixel, in memory order.
+struct PackedLayout
+{
+	short weights[4];
+	unsigned int pixelSize;
+};
+
+
+//--------------------------------------------------------------------------------//
+
+
+static bool getPackedLayout(AR_PIXEL_FORMAT pixelFormat, PackedLayout &layout)
+{
+	const short R = LUMA_WEIGHT_R, G = LUMA_WEIGHT_G, B = LUMA_WEIGHT_B;
+
+	switch (pixelFormat)
+	{
+	case AR_PIXEL_FORMAT_RGB:	layout = { { R, G, B, 0 }, 3 }; return true;
+	case AR_PIXEL_FORMAT_BGR:	layout = { { B, G, R, 0 }, 3 }; return true;
+	case AR_PIXEL_FORMAT_RGBA:	layout = { { R, G, B, 0 }, 4 }; return true;
+	case AR_PIXEL_FORMAT_BGRA:	layout = { { B, G, R, 0 }, 4 }; return true;
+	case AR_PIXEL_FORMAT_ABGR:	layout = { { 0, B, G, R }, 4 }; return true;
+	case AR_PIXEL_FORMAT_ARGB:	layout = { { 0, R, G, B }, 4 }; return true;
+	default:					break;
+	}
+
+	return false;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+static void convertPackedScalar(const ubyte* p_source, ubyte* p_destination, unsigned int pixelCount, const PackedLayout &layout)
+{
+	const short* w = layout.weights;
+
+	if (layout.pixelSize == 3)
+	{
+		for (unsigned int i = 0; i < pixelCount; i++, p_source += 3)
+		{
+			p_destination[i] = (ubyte)((w[0] * p_source[0] + w[1] * p_source[1] + w[2] * p_source[2] + 128) >> 8);
+		}
+	}
+	else
+	{
+		for (unsigned int i = 0; i < pixelCount; i++, p_source += 4)
+		{
+			p_destination[i] = (ubyte)((w[0] * p_source[0] + w[1] * p_source[1] + w[2] * p_source[2] + w[3] * p_source[3] + 128) >> 8);
+		}
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+#ifdef LUMA_X86
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// DESCRIPTION: Luminance of four 4-byte pixels.
+// OUTPUT: Four 32-bit lanes, each in [0, 255].
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+static inline __m128i lumaOfFourPixels(__m128i pixels, __m128i weights)
+{
+	const __m128i zero = _mm_setzero_si128();
+
+	// Each 32-bit lane holds the weighted sum of two channels of one pixel.
+	__m128i low = _mm_madd_epi16(_mm_unpacklo_epi8(pixels, zero), weights);
+	__m128i high = _mm_madd_epi16(_mm_unpackhi_epi8(pixels, zero), weights);
+
+	__m128 lowF = _mm_castsi128_ps(low), highF = _mm_castsi128_ps(high);
+	__m128i even = _mm_castps_si128(_mm_shuffle_ps(lowF, highF, _MM_SHUFFLE(2, 0, 2, 0)));
+	__m128i odd = _mm_castps_si128(_mm_shuffle_ps(lowF, highF, _MM_SHUFFLE(3, 1, 3, 1)));
+
+	return _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(even, odd), _mm_set1_epi32(128)), 8);
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+static unsigned int convertPacked4SSE2(const ubyte* p_source, ubyte* p_destination, unsigned int pixelCount, const PackedLayout &layout)
+{
+	const short* w = layout.weights;
+	const __m128i weights = _mm_setr_epi16(w[0], w[1], w[2], w[3], w[0], w[1], w[2], w[3]);
+
+	unsigned int i = 0;
+	for (; i + 16 <= pixelCount; i += 16)
+	{
+		const __m128i* p_in = (const __m128i*)(p_source + i * 4);
+
+		__m128i l0 = lumaOfFourPixels(_mm_loadu_si128(p_in + 0), weights);
+		__m128i l1 = lumaOfFourPixels(_mm_loadu_si128(p_in + 1), weights);
+		__m128i l2 = lumaOfFourPixels(_mm_loadu_si128(p_in + 2), weights);
+		__m128i l3 = lumaOfFourPixels(_mm_loadu_si128(p_in + 3), weights);
+
+		__m128i packed = _mm_packus_epi16(_mm_packs_epi32(l0, l1), _mm_packs_epi32(l2, l3));
+		_mm_storeu_si128((__m128i*)(p_destination + i), packed);
+	}
+
+	return i; // Pixels converted
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+LUMA_TARGET_SSSE3
+static unsigned int convertPacked3SSSE3(const ubyte* p_source, ubyte* p_destination, unsigned int pixelCount, const PackedLayout &layout)
+{
+	const short* w = layout.weights;
+	const __m128i weights = _mm_setr_epi16(w[0], w[1], w[2], 0, w[0], w[1], w[2], 0);
+	// Spreads four 3-byte pixels into four 4-byte pixels with a zero fourth byte.
+	const __m128i expand = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+
+	unsigned int i = 0;
+	// The last load reads 4 bytes past the 16 pixels, so stop while 2 more pixels remain.
+	for (; i + 18 <= pixelCount; i += 16)
+	{
+		const ubyte* p_in = p_source + i * 3;
+
+		__m128i l0 = lumaOfFourPixels(_mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(p_in + 0)), expand), weights);
+		__m128i l1 = lumaOfFourPixels(_mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(p_in + 12)), expand), weights);
+		__m128i l2 = lumaOfFourPixels(_mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(p_in + 24)), expand), weights);
+		__m128i l3 = lumaOfFourPixels(_mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(p_in + 36)), expand), weights);
+
+		__m128i packed = _mm_packus_epi16(_mm_packs_epi32(l0, l1), _mm_packs_epi32(l2, l3));
+		_mm_storeu_si128((__m128i*)(p_destination + i), packed);
+	}
+
+	return i; // Pixels converted
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+static bool cpuHasSSSE3()
+{
+#ifdef _MSC_VER
+	int info[4];
+	__cpuid(info, 1);
+	return (info[2] & (1 << 9)) != 0;
+#else
+	return __builtin_cpu_supports("ssse3") != 0;
+#endif
+}
+
+static const bool g_hasSSSE3 = cpuHasSSSE3();
+
+#endif // LUMA_X86
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool convertToLuma(const ubyte* p_source, ubyte* p_destination, unsigned int pixelCount, AR_PIXEL_FORMAT pixelFormat)
+{
+	PackedLayout layout;
+
+	if (getPackedLayout(pixelFormat, layout))
+	{
+		unsigned int done = 0;
+
+#ifdef LUMA_X86
+		if (layout.pixelSize == 4)
+		{
+			done = convertPacked4SSE2(p_source, p_destination, pixelCount, layout);
+		}
+		else if (g_hasSSSE3)
+		{
+			done = convertPacked3SSSE3(p_source, p_destination, pixelCount, layout);
+		}
+#endif
+
+		convertPackedScalar(p_source + done * layout.pixelSize, p_destination + done, pixelCount - done, layout);
+		return true;
+	}
+
+	const ubyte* s = p_source;
+	ubyte r, g, b;
+
+	switch (pixelFormat)
+	{
+	case AR_PIXEL_FORMAT_MONO:
+	case AR_PIXEL_FORMAT_420v: // Planar formats start with a full-resolution Y plane.
+	case AR_PIXEL_FORMAT_420f:
+	case AR_PIXEL_FORMAT_NV21:
+		memcpy(p_destination, p_source, pixelCount);
+		break;
+
+	case AR_PIXEL_FORMAT_2vuy: // U Y0 V Y1
+		for (unsigned int i = 0; i < pixelCount; i++)
+		{
+			p_destination[i] = s[i * 2 + 1];
+		}
+		break;
+
+	case AR_PIXEL_FORMAT_yuvs: // Y0 U Y1 V
+		for (unsigned int i = 0; i < pixelCount; i++)
+		{
+			p_destination[i] = s[i * 2];
+		}
+		break;
+
+	// 16-BIT FORMATS (same bit layout ARToolKit uses)
+	case AR_PIXEL_FORMAT_RGB_565:
+		for (unsigned int i = 0; i < pixelCount; i++, s += 2)
+		{
+			r = s[0] & 0xf8;
+			g = ((s[0] & 0x07) << 5) | ((s[1] & 0xe0) >> 3);
+			b = (s[1] & 0x1f) << 3;
+			p_destination[i] = (ubyte)((LUMA_WEIGHT_R * r + LUMA_WEIGHT_G * g + LUMA_WEIGHT_B * b + 128) >> 8);
+		}
+		break;
+
+	case AR_PIXEL_FORMAT_RGBA_5551:
+		for (unsigned int i = 0; i < pixelCount; i++, s += 2)
+		{
+			r = s[0] & 0xf8;
+			g = ((s[0] & 0x07) << 5) | ((s[1] & 0xc0) >> 3);
+			b = (s[1] & 0x3e) << 2;
+			p_destination[i] = (ubyte)((LUMA_WEIGHT_R * r + LUMA_WEIGHT_G * g + LUMA_WEIGHT_B * b + 128) >> 8);
+		}
+		break;
+
+	case AR_PIXEL_FORMAT_RGBA_4444:
+		for (unsigned int i = 0; i < pixelCount; i++, s += 2)
+		{
+			r = s[0] & 0xf0;
+			g = (s[0] & 0x0f) << 4;
+			b = s[1] & 0xf0;
+			p_destination[i] = (ubyte)((LUMA_WEIGHT_R * r + LUMA_WEIGHT_G * g + LUMA_WEIGHT_B * b + 128) >> 8);
+		}
+		break;
+
+	default:
+		return false;
+	}
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void halveLuma(const ubyte* p_source, unsigned int width, unsigned int height, ubyte* p_destination)
+{
+	unsigned int halfWidth = width / 2;
+	unsigned int halfHeight = height / 2;
+
+	for (unsigned int y = 0; y < halfHeight; y++)
+	{
+		const ubyte* p_row0 = p_source + (2 * y) * width;
+		const ubyte* p_row1 = p_row0 + width;
+		ubyte* p_out = p_destination + y * halfWidth;
+		unsigned int x = 0;
+
+#ifdef LUMA_X86
+		const __m128i lowBytes = _mm_set1_epi16(0x00FF);
+		const __m128i one = _mm_set1_epi16(1);
+
+		for (; x + 16 <= halfWidth; x += 16)
+		{
+			// Average vertically, then average neighbouring columns.
+			__m128i v0 = _mm_avg_epu8(_mm_loadu_si128((const __m128i*)(p_row0 + 2 * x)), _mm_loadu_si128((const __m128i*)(p_row1 + 2 * x)));
+			__m128i v1 = _mm_avg_epu8(_mm_loadu_si128((const __m128i*)(p_row0 + 2 * x + 16)), _mm_loadu_si128((const __m128i*)(p_row1 + 2 * x + 16)));
+
+			__m128i h0 = _mm_add_epi16(_mm_add_epi16(_mm_and_si128(v0, lowBytes), _mm_srli_epi16(v0, 8)), one);
+			__m128i h1 = _mm_add_epi16(_mm_add_epi16(_mm_and_si128(v1, lowBytes), _mm_srli_epi16(v1, 8)), one);
+
+			_mm_storeu_si128((__m128i*)(p_out + x), _mm_packus_epi16(_mm_srli_epi16(h0, 1), _mm_srli_epi16(h1, 1)));
+		}
+#endif
+
+		// Same rounding as the vector path, so results do not depend on the width.
+		for (; x < halfWidth; x++)
+		{
+			int left = (p_row0[2 * x] + p_row1[2 * x] + 1) >> 1;
+			int right = (p_row0[2 * x + 1] + p_row1[2 * x + 1] + 1) >> 1;
+			p_out[x] = (ubyte)((left + right + 1) >> 1);
+		}
+	}
+}
+
+
+//================================================================================//
+
+
+LumaPlane::LumaPlane()
+{
+	m_width = 0;
+	m_height = 0;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+LumaPlane::LumaPlane(unsigned int width, unsigned int height, bool halfResolution)
+{
+	m_width = 0;
+	m_height = 0;
+	resize(width, height, halfResolution);
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void LumaPlane::resize(unsigned int width, unsigned int height, bool halfResolution)
+{
+	m_width = width;
+	m_height = height;
+
+	m_pixels.resize(width * height);
+	if (halfResolution)
+	{
+		m_halfPixels.resize((width / 2) * (height / 2));
+	}
+	else
+	{
+		m_halfPixels.clear();
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void LumaPlane::copyFrom(const LumaPlane &source)
+{
+	m_width = source.m_width;
+	m_height = source.m_height;
+	m_pixels = source.m_pixels;
+	m_halfPixels = source.m_halfPixels;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool LumaPlane::build(const ubyte* p_frame, AR_PIXEL_FORMAT pixelFormat)
+{
+	if (p_frame == NULL || !convertToLuma(p_frame, m_pixels.data(), m_width * m_height, pixelFormat))
+	{
+		return false;
+	}
+
+	if (hasHalfResolution())
+	{
+		buildHalfResolution();
+	}
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool LumaPlane::build(Image &frame, AR_PIXEL_FORMAT pixelFormat)
+{
+	if (frame.getWidth() != m_width || frame.getHeight() != m_height)
+	{
+		throw(Error::DimensionsMismatchException());
+	}
+
+	if (frame.isPacked())
+	{
+		return build(frame.getPixelBuffer(), pixelFormat);
+	}
+
+	// Padded rows are converted one at a time.
+	for (unsigned int y = 0; y < m_height; y++)
+	{
+		if (!convertToLuma(frame.getRow(y), m_pixels.data() + y * m_width, m_width, pixelFormat))
+		{
+			return false;
+		}
+	}
+
+	if (hasHalfResolution())
+	{
+		buildHalfResolution();
+	}
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void LumaPlane::buildHalfResolution()
+{
+	halveLuma(m_pixels.data(), m_width, m_height, m_halfPixels.data());
+}
\ No newline at end of file
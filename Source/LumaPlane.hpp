@@ -0,0 +1,95 @@
+//================================================================================//
+// LumaPlane
+//	- 8-bit luminance plane extracted once per camera frame.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//--------------------------------------------------------------------------------//
+// NOTE: Detection, threshold selection and surface sampling all read this plane
+//		 instead of deriving luminance from packed pixels on their own. Packed
+//		 8-bit RGB(A) formats are converted with SSE2 (4-byte pixels) or SSSE3
+//		 (3-byte pixels) on x86; every other format uses the scalar path.
+//		 The weights are glm::luminosity()'s (0.33, 0.59, 0.11) scaled to sum to
+//		 256, so a plane value times LUMA_TO_LUMINOSITY matches what
+//		 glm::luminosity() returns for the same pixel.
+//================================================================================//
+#pragma once
+
+#include<AR/ar.h>
+#include<vector>
+
+#include "TypeDef.hpp"
+#include "Texture.hpp"
+
+
+// Converts a plane value [0, 255] to the scale of glm::luminosity() on [0, 1] colors.
+static const float LUMA_TO_LUMINOSITY = 1.03f / 255.0f;
+
+
+class LumaPlane
+{
+public:
+	LumaPlane();
+	LumaPlane(unsigned int width, unsigned int height, bool halfResolution = false);
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Converts a frame to luminance.
+	// OUTPUT: False if the pixel format is not supported.
+	// MUTATES:
+	//	- m_pixels, m_halfPixels (when half resolution is enabled)
+	// NOTES: The frame must have the plane's dimensions.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool build(const ubyte* p_frame, AR_PIXEL_FORMAT pixelFormat);
+	bool build(Image &frame, AR_PIXEL_FORMAT pixelFormat);
+
+	// Reallocates for new dimensions. Contents are undefined until the next build().
+	void resize(unsigned int width, unsigned int height, bool halfResolution);
+
+	// Copies another plane, resizing to match it.
+	void copyFrom(const LumaPlane &source);
+
+	// GETTERS
+	inline ubyte* getPixels() { return m_pixels.data(); }
+	inline const ubyte* getPixels() const { return m_pixels.data(); }
+	inline unsigned int getWidth() const { return m_width; }
+	inline unsigned int getHeight() const { return m_height; }
+	inline ubyte get(unsigned int x, unsigned int y) const { return m_pixels[y * m_width + x]; }
+
+	// HALF RESOLUTION PLANE (2x2 box filtered)
+	inline bool hasHalfResolution() const { return !m_halfPixels.empty(); }
+	inline ubyte* getHalfPixels() { return m_halfPixels.data(); }
+	inline const ubyte* getHalfPixels() const { return m_halfPixels.data(); }
+	inline unsigned int getHalfWidth() const { return m_width / 2; }
+	inline unsigned int getHalfHeight() const { return m_height / 2; }
+
+private:
+	std::vector<ubyte> m_pixels;
+	std::vector<ubyte> m_halfPixels;
+	unsigned int m_width;
+	unsigned int m_height;
+
+	void buildHalfResolution();
+};
+
+
+//================================================================================//
+
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Converts a run of pixels to 8-bit luminance.
+// OUTPUT: False if the pixel format is not supported.
+// ARGUMENTS:
+//	- p_source: Pixels in pixelFormat.
+//	- p_destination: pixelCount bytes.
+//	- pixelCount: Number of pixels to convert.
+// NOTES: Planar and 4:2:2 YUV formats copy their Y samples directly.
+//---------------------------------------------------------------------------//
+bool convertToLuma(const ubyte* p_source, ubyte* p_destination, unsigned int pixelCount, AR_PIXEL_FORMAT pixelFormat);
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Halves a luma plane in both dimensions with a 2x2 box filter.
+// ARGUMENTS:
+//	- p_source: width * height bytes.
+//	- p_destination: (width / 2) * (height / 2) bytes.
+//---------------------------------------------------------------------------//
+void halveLuma(const ubyte* p_source, unsigned int width, unsigned int height, ubyte* p_destination);
\ No newline at end of file
@@ -0,0 +1,575 @@
+//================================================================================//
+// MarkerCandidates
+//	- Full-resolution refinement and identification of square marker candidates
+//	  found somewhere other than the full frame (a coarse pyramid level, a region
+//	  of interest, ...).
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//================================================================================//
+#include "MarkerCandidates.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <climits>
+#include <algorithm>
+
+
+static const int MAX_EDGE_SAMPLES = 32;
+static const int MAX_PROFILE_LENGTH = 61;	// Search positions along one normal, half a pixel apart
+static const float MIN_EDGE_STEP = 8.0f;	// Smallest intensity change accepted as an edge
+
+// Directions of ComponentExtremes: every 45 degrees, starting along +x.
+static const int EXTREME_DX[8] = { 1, 1, 0, -1, -1, -1, 0, 1 };
+static const int EXTREME_DY[8] = { 0, 1, 1, 1, 0, -1, -1, -1 };
+
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// DESCRIPTION: Bilinearly interpolated luminance.
+// OUTPUT: Luminance, or -1 if (x, y) is too close to the border.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+static float sampleBilinear(const LumaPlane &luma, float x, float y)
+{
+	if (x < 0 || y < 0 || x >= luma.getWidth() - 1 || y >= luma.getHeight() - 1)
+	{
+		return -1;
+	}
+
+	int ix = (int)x, iy = (int)y;
+	float fx = x - ix, fy = y - iy;
+	const ubyte* p = luma.getPixels() + iy * luma.getWidth() + ix;
+
+	float top = p[0] + fx * (p[1] - p[0]);
+	float bottom = p[luma.getWidth()] + fx * (p[luma.getWidth() + 1] - p[luma.getWidth()]);
+	return top + fy * (bottom - top);
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// DESCRIPTION: Finds the strongest intensity step along a line segment.
+// OUTPUT: False if no step of at least MIN_EDGE_STEP was found.
+// INPUT:
+//	* (x, y): Centre of the search, in observed pixels.
+//	* (nx, ny): Unit search direction.
+//	* offset: Receives the step's distance from the centre.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+static bool findEdge(const LumaPlane &luma, float x, float y, float nx, float ny, float radius, float &offset)
+{
+	float steps[MAX_PROFILE_LENGTH];
+	int length = (int)(radius * 4) + 1;
+	if (length > MAX_PROFILE_LENGTH)
+	{
+		length = MAX_PROFILE_LENGTH;
+		radius = (length - 1) / 4.0f;
+	}
+
+	int best = -1;
+	float bestStep = MIN_EDGE_STEP;
+
+	for (int k = 0; k < length; k++)
+	{
+		float d = -radius + k * 0.5f;
+		float before = sampleBilinear(luma, x + nx * (d - 0.5f), y + ny * (d - 0.5f));
+		float after = sampleBilinear(luma, x + nx * (d + 0.5f), y + ny * (d + 0.5f));
+		if (before < 0 || after < 0)
+		{
+			return false; // Search runs off the image
+		}
+
+		steps[k] = fabs(after - before);
+		if (steps[k] > bestStep)
+		{
+			bestStep = steps[k];
+			best = k;
+		}
+	}
+
+	if (best < 0)
+	{
+		return false;
+	}
+
+	// Parabolic interpolation between neighbouring positions.
+	float subStep = 0;
+	if (best > 0 && best < length - 1)
+	{
+		float denominator = steps[best - 1] - 2 * steps[best] + steps[best + 1];
+		if (denominator < 0)
+		{
+			subStep = 0.5f * (steps[best - 1] - steps[best + 1]) / denominator;
+		}
+	}
+
+	offset = -radius + (best + subStep) * 0.5f;
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void scaleCandidate(ARMarkerInfo &candidate, ARdouble scale)
+{
+	candidate.area = (int)(candidate.area * scale * scale);
+	candidate.pos[0] *= scale;
+	candidate.pos[1] *= scale;
+
+	for (int i = 0; i < 4; i++)
+	{
+		candidate.vertex[i][0] *= scale;
+		candidate.vertex[i][1] *= scale;
+		candidate.line[i][2] *= scale; // a*x + b*y + c = 0 with x and y scaled
+	}
+
+	candidate.markerInfo2Ptr = NULL; // Refers to the detection image, not the frame.
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void translateCandidate(ARMarkerInfo &candidate, ARdouble x, ARdouble y)
+{
+	candidate.pos[0] += x;
+	candidate.pos[1] += y;
+
+	for (int i = 0; i < 4; i++)
+	{
+		candidate.vertex[i][0] += x;
+		candidate.vertex[i][1] += y;
+		candidate.line[i][2] -= candidate.line[i][0] * x + candidate.line[i][1] * y;
+	}
+
+	candidate.markerInfo2Ptr = NULL; // Refers to the tile's handle.
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool projectCandidate(const ARParam &param, ARdouble transform[3][4], ARdouble width, ARMarkerInfo &candidate)
+{
+	const ARdouble corners[4][2] = { { -1, 1 }, { 1, 1 }, { 1, -1 }, { -1, -1 } };
+
+	candidate.pos[0] = candidate.pos[1] = 0;
+	for (int i = 0; i < 4; i++)
+	{
+		ARdouble point[3];
+		for (int r = 0; r < 3; r++)
+		{
+			point[r] = transform[r][0] * corners[i][0] * width / 2 + transform[r][1] * corners[i][1] * width / 2 + transform[r][3];
+		}
+		if (point[2] <= 0)
+		{
+			return false;
+		}
+
+		ARdouble image[3];
+		for (int r = 0; r < 3; r++)
+		{
+			image[r] = param.mat[r][0] * point[0] + param.mat[r][1] * point[1] + param.mat[r][2] * point[2] + param.mat[r][3];
+		}
+		candidate.vertex[i][0] = image[0] / image[2];
+		candidate.vertex[i][1] = image[1] / image[2];
+
+		if (candidate.vertex[i][0] < 0 || candidate.vertex[i][1] < 0
+			|| candidate.vertex[i][0] >= param.xsize || candidate.vertex[i][1] >= param.ysize)
+		{
+			return false;
+		}
+
+		candidate.pos[0] += candidate.vertex[i][0] / 4;
+		candidate.pos[1] += candidate.vertex[i][1] / 4;
+	}
+
+	ARdouble area = 0;
+	for (int i = 0; i < 4; i++)
+	{
+		const ARdouble* p_start = candidate.vertex[i];
+		const ARdouble* p_end = candidate.vertex[(i + 1) % 4];
+		ARdouble dx = p_end[0] - p_start[0], dy = p_end[1] - p_start[1];
+		ARdouble length = sqrt(dx * dx + dy * dy);
+		if (length <= 0)
+		{
+			return false;
+		}
+
+		candidate.line[i][0] = -dy / length;
+		candidate.line[i][1] = dx / length;
+		candidate.line[i][2] = -(candidate.line[i][0] * p_start[0] + candidate.line[i][1] * p_start[1]);
+		area += p_start[0] * p_end[1] - p_end[0] * p_start[1];
+	}
+
+	candidate.area = (int)fabs(area / 2);
+	candidate.id = candidate.idPatt = candidate.idMatrix = -1;
+	candidate.dir = candidate.dirPatt = candidate.dirMatrix = 0;
+	candidate.cf = candidate.cfPatt = candidate.cfMatrix = -1;
+	candidate.markerInfo2Ptr = NULL;
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool refineCandidate(const LumaPlane &luma, ARParamLTf* p_paramLTf, ARMarkerInfo &candidate, float searchRadius)
+{
+	ARdouble lines[4][3];
+	ARdouble vertices[4][2];
+
+	for (int edge = 0; edge < 4; edge++)
+	{
+		const ARdouble* p_start = candidate.vertex[edge];
+		const ARdouble* p_end = candidate.vertex[(edge + 1) % 4];
+
+		// EDGE NORMAL IN THE OBSERVED IMAGE
+		float ox0, oy0, ox1, oy1;
+		if (arParamIdeal2ObservLTf(p_paramLTf, (float)p_start[0], (float)p_start[1], &ox0, &oy0) < 0
+			|| arParamIdeal2ObservLTf(p_paramLTf, (float)p_end[0], (float)p_end[1], &ox1, &oy1) < 0)
+		{
+			return false;
+		}
+
+		float dx = ox1 - ox0, dy = oy1 - oy0;
+		float edgeLength = sqrt(dx * dx + dy * dy);
+		if (edgeLength < 4)
+		{
+			return false;
+		}
+		float nx = -dy / edgeLength, ny = dx / edgeLength;
+
+		// EDGE POINTS, avoiding the corners where two edges blur together
+		int sampleCount = (int)(edgeLength / 2);
+		sampleCount = (sampleCount < 6) ? 6 : (sampleCount > MAX_EDGE_SAMPLES ? MAX_EDGE_SAMPLES : sampleCount);
+
+		ARdouble points[MAX_EDGE_SAMPLES][2];
+		int pointCount = 0;
+
+		for (int s = 0; s < sampleCount; s++)
+		{
+			ARdouble t = 0.15 + 0.7 * (s + 0.5) / sampleCount;
+			float ix = (float)(p_start[0] + t * (p_end[0] - p_start[0]));
+			float iy = (float)(p_start[1] + t * (p_end[1] - p_start[1]));
+			float ox, oy, offset;
+
+			if (arParamIdeal2ObservLTf(p_paramLTf, ix, iy, &ox, &oy) < 0
+				|| !findEdge(luma, ox, oy, nx, ny, searchRadius, offset))
+			{
+				continue;
+			}
+
+			if (arParamObserv2IdealLTf(p_paramLTf, ox + nx * offset, oy + ny * offset, &ix, &iy) < 0)
+			{
+				continue;
+			}
+
+			points[pointCount][0] = ix;
+			points[pointCount][1] = iy;
+			pointCount++;
+		}
+
+		if (pointCount < 4 || pointCount < sampleCount / 2)
+		{
+			return false;
+		}
+
+		// TOTAL LEAST SQUARES LINE
+		ARdouble meanX = 0, meanY = 0;
+		for (int i = 0; i < pointCount; i++)
+		{
+			meanX += points[i][0];
+			meanY += points[i][1];
+		}
+		meanX /= pointCount;
+		meanY /= pointCount;
+
+		ARdouble xx = 0, xy = 0, yy = 0;
+		for (int i = 0; i < pointCount; i++)
+		{
+			ARdouble x = points[i][0] - meanX, y = points[i][1] - meanY;
+			xx += x * x;
+			xy += x * y;
+			yy += y * y;
+		}
+
+		ARdouble theta = 0.5 * atan2(2 * xy, xx - yy); // Direction of the edge
+		lines[edge][0] = -sin(theta);
+		lines[edge][1] = cos(theta);
+		lines[edge][2] = -(lines[edge][0] * meanX + lines[edge][1] * meanY);
+	}
+
+	// CORNERS: vertex i lies where edge i-1 meets edge i.
+	for (int i = 0; i < 4; i++)
+	{
+		const ARdouble* l1 = lines[(i + 3) % 4];
+		const ARdouble* l2 = lines[i];
+		ARdouble determinant = l1[0] * l2[1] - l2[0] * l1[1];
+		if (fabs(determinant) < 1e-6)
+		{
+			return false; // Parallel neighbours
+		}
+
+		vertices[i][0] = (l1[1] * l2[2] - l2[1] * l1[2]) / determinant;
+		vertices[i][1] = (l2[0] * l1[2] - l1[0] * l2[2]) / determinant;
+
+		ARdouble moveX = vertices[i][0] - candidate.vertex[i][0];
+		ARdouble moveY = vertices[i][1] - candidate.vertex[i][1];
+		if (moveX * moveX + moveY * moveY > 4 * searchRadius * searchRadius)
+		{
+			return false; // Locked onto some other edge
+		}
+	}
+
+	candidate.pos[0] = candidate.pos[1] = 0;
+	for (int i = 0; i < 4; i++)
+	{
+		for (int j = 0; j < 3; j++)
+		{
+			candidate.line[i][j] = lines[i][j];
+		}
+		candidate.vertex[i][0] = vertices[i][0];
+		candidate.vertex[i][1] = vertices[i][1];
+		candidate.pos[0] += vertices[i][0] / 4;
+		candidate.pos[1] += vertices[i][1] / 4;
+	}
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool identifyCandidate(ARHandle* p_arHandle, LumaPlane &luma, ARParamLT* p_paramLT, ARMarkerInfo &candidate,
+	const PatternBank* p_bank, const PatternHint* p_hint)
+{
+	int code, dir;
+	ARdouble cf;
+
+	if (p_bank != nullptr && !p_bank->isEmpty())
+	{
+		if (!p_bank->identify(luma, &p_paramLT->paramLTf, p_arHandle->arImageProcMode, candidate.vertex, p_arHandle->pattRatio, code, dir, cf, p_hint))
+		{
+			candidate.id = candidate.idPatt = -1;
+			return false;
+		}
+	}
+	else if (arPattGetID2(p_arHandle->pattHandle, p_arHandle->arImageProcMode, p_arHandle->arPatternDetectionMode,
+		luma.getPixels(), luma.getWidth(), luma.getHeight(), AR_PIXEL_FORMAT_MONO, &p_paramLT->paramLTf,
+		candidate.vertex, p_arHandle->pattRatio, &code, &dir, &cf, p_arHandle->matrixCodeType) < 0 || code < 0)
+	{
+		candidate.id = candidate.idPatt = -1;
+		return false;
+	}
+
+	candidate.id = candidate.idPatt = code;
+	candidate.dir = candidate.dirPatt = dir;
+	candidate.cf = candidate.cfPatt = cf;
+	candidate.idMatrix = -1;
+	candidate.cfMatrix = -1;
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void resetExtremes(ComponentExtremes &extremes)
+{
+	extremes.area = 0;
+	for (int d = 0; d < 8; d++)
+	{
+		extremes.score[d] = INT_MIN;
+		extremes.x[d] = extremes.y[d] = 0;
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void addRunToExtremes(ComponentExtremes &extremes, int x0, int x1, int y)
+{
+	extremes.area += x1 - x0 + 1;
+	for (int d = 0; d < 8; d++)
+	{
+		// A run's furthest pixel along any direction is one of its ends.
+		int x = (EXTREME_DX[d] > 0) ? x1 : x0;
+		int score = EXTREME_DX[d] * x + EXTREME_DY[d] * y;
+		if (score > extremes.score[d])
+		{
+			extremes.score[d] = score;
+			extremes.x[d] = x;
+			extremes.y[d] = y;
+		}
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void mergeExtremes(ComponentExtremes &into, const ComponentExtremes &from)
+{
+	into.area += from.area;
+	for (int d = 0; d < 8; d++)
+	{
+		if (from.score[d] > into.score[d])
+		{
+			into.score[d] = from.score[d];
+			into.x[d] = from.x[d];
+			into.y[d] = from.y[d];
+		}
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool fitComponentQuad(const ComponentExtremes &extremes, int width, int height, int minArea, ComponentQuad &quad)
+{
+	// Touching the border: the extremes along +x, +y, -x and -y give the bounding box.
+	if (extremes.score[0] >= width - 1 || extremes.score[2] >= height - 1
+		|| extremes.score[4] >= 0 || extremes.score[6] >= 0)
+	{
+		return false;
+	}
+
+	// DISTINCT EXTREME PIXELS, in order around their centroid
+	float points[8][2];
+	int pointCount = 0;
+	for (int d = 0; d < 8; d++)
+	{
+		float x = (float)extremes.x[d];
+		float y = (float)extremes.y[d];
+
+		bool duplicate = false;
+		for (int i = 0; i < pointCount && !duplicate; i++)
+		{
+			duplicate = (points[i][0] == x && points[i][1] == y);
+		}
+		if (!duplicate)
+		{
+			points[pointCount][0] = x;
+			points[pointCount][1] = y;
+			pointCount++;
+		}
+	}
+	if (pointCount < 4)
+	{
+		return false;
+	}
+
+	float centerX = 0, centerY = 0;
+	for (int i = 0; i < pointCount; i++)
+	{
+		centerX += points[i][0] / pointCount;
+		centerY += points[i][1] / pointCount;
+	}
+
+	int order[8];
+	float angles[8];
+	for (int i = 0; i < pointCount; i++)
+	{
+		order[i] = i;
+		angles[i] = atan2(points[i][1] - centerY, points[i][0] - centerX);
+	}
+	std::sort(order, order + pointCount, [&angles](int a, int b) { return angles[a] < angles[b]; });
+
+	// LARGEST QUAD, keeping the angular order so it stays convex
+	int best[4] = { 0, 1, 2, 3 };
+	float bestArea = -1;
+	for (int a = 0; a < pointCount; a++)
+	for (int b = a + 1; b < pointCount; b++)
+	for (int c = b + 1; c < pointCount; c++)
+	for (int d = c + 1; d < pointCount; d++)
+	{
+		const int corners[4] = { order[a], order[b], order[c], order[d] };
+		float area = 0;
+		for (int i = 0; i < 4; i++)
+		{
+			const float* p_start = points[corners[i]];
+			const float* p_end = points[corners[(i + 1) % 4]];
+			area += p_start[0] * p_end[1] - p_end[0] * p_start[1];
+		}
+		area /= 2;
+
+		if (area > bestArea)
+		{
+			bestArea = area;
+			std::copy(corners, corners + 4, best);
+		}
+	}
+
+	// A square's other extremes lie on its edges; a blob's stick out.
+	float tolerance = std::max(2.0f, 0.05f * sqrtf(bestArea));
+	for (int i = 0; i < pointCount; i++)
+	{
+		for (int edge = 0; edge < 4; edge++)
+		{
+			const float* p_start = points[best[edge]];
+			const float* p_end = points[best[(edge + 1) % 4]];
+			float dx = p_end[0] - p_start[0], dy = p_end[1] - p_start[1];
+			float length = sqrtf(dx * dx + dy * dy);
+
+			// Outward distance; the corners run clockwise on screen, so outside is to the left.
+			float outside = (dy * (points[i][0] - p_start[0]) - dx * (points[i][1] - p_start[1])) / length;
+			if (length > 0 && outside > tolerance)
+			{
+				return false;
+			}
+		}
+	}
+
+	// Pixel centres enclose a little less than the pixels; a thick border covers most of its square.
+	float fill = extremes.area / std::max(bestArea, 1.0f);
+	if (bestArea < minArea / 2 || fill < 0.2f || fill > 1.5f)
+	{
+		return false;
+	}
+
+	for (int i = 0; i < 4; i++)
+	{
+		quad.vertex[i][0] = points[best[i]][0];
+		quad.vertex[i][1] = points[best[i]][1];
+	}
+	quad.area = extremes.area;
+	quad.previous = -1;
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool quadToCandidate(const ComponentQuad &quad, ARParamLTf* p_paramLTf, ARMarkerInfo &candidate)
+{
+	memset(&candidate, 0, sizeof(candidate));
+
+	for (int i = 0; i < 4; i++)
+	{
+		float ix, iy;
+		if (arParamObserv2IdealLTf(p_paramLTf, quad.vertex[i][0], quad.vertex[i][1], &ix, &iy) < 0)
+		{
+			return false;
+		}
+
+		candidate.vertex[i][0] = ix;
+		candidate.vertex[i][1] = iy;
+		candidate.pos[0] += ix / 4;
+		candidate.pos[1] += iy / 4;
+	}
+
+	candidate.area = quad.area;
+	candidate.id = candidate.idPatt = candidate.idMatrix = -1;
+	candidate.cf = candidate.cfPatt = candidate.cfMatrix = -1;
+
+	return true;
+}
\ No newline at end of file
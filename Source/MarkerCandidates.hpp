@@ -0,0 +1,148 @@
+//================================================================================//
+// MarkerCandidates
+//	- Full-resolution refinement and identification of square marker candidates
+//	  found somewhere other than the full frame (a coarse pyramid level, a tile,
+//	  a region of interest, ...).
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//--------------------------------------------------------------------------------//
+// NOTE: Candidates are ARMarkerInfo structures in ideal (undistorted) full-frame
+//		 coordinates, the same convention arDetectMarker() uses, so refined
+//		 candidates can be handed straight to arGetTransMatSquare().
+//================================================================================//
+#pragma once
+
+#include<AR/ar.h>
+
+#include "LumaPlane.hpp"
+#include "PatternBank.hpp"
+
+
+// Pixels of a connected component furthest along eight directions, 45 degrees apart starting along +x.
+struct ComponentExtremes
+{
+	int area;				// Pixels in the component
+	int score[8];			// Largest dot product of a pixel with each direction
+	int x[8];				// Pixel that has it
+	int y[8];
+};
+
+
+// A dark component's quad, in plane (observed) coordinates.
+struct ComponentQuad
+{
+	float vertex[4][2];		// Clockwise on screen, starting from any corner
+	int area;				// Pixels in the component
+	int previous;			// ComponentTree: the same component's index at the previous threshold, if unchanged; else -1
+};
+
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Rescales a candidate found on a downsampled image to
+//				full-frame ideal coordinates.
+// ARGUMENTS:
+//	- candidate: Candidate to scale in place.
+//	- scale: Full-resolution size divided by the detection image size.
+//---------------------------------------------------------------------------//
+void scaleCandidate(ARMarkerInfo &candidate, ARdouble scale);
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Moves a candidate found in a tile to full-frame ideal
+//				coordinates.
+// ARGUMENTS:
+//	- candidate: Candidate to move in place.
+//	- x, y: Position of the tile's top left corner in the frame.
+// NOTES: Exact when the tile's camera parameters are the frame's with the
+//		  principal point and distortion centre moved by (-x, -y).
+//---------------------------------------------------------------------------//
+void translateCandidate(ARMarkerInfo &candidate, ARdouble x, ARdouble y);
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Builds the candidate a square marker would produce at a given
+//				pose, with its corners in the order arGetTransMatSquare()
+//				expects for dir 0.
+// OUTPUT: False if a corner falls behind the camera or outside the image.
+// ARGUMENTS:
+//	- param: Camera parameters of the full-resolution image.
+//	- transform: Camera-from-marker transform, as ARToolKit reports it.
+//	- width: Marker width passed to arGetTransMatSquare().
+//	- candidate: Receives vertex, line, pos and area; id is reset to -1.
+//---------------------------------------------------------------------------//
+bool projectCandidate(const ARParam &param, ARdouble transform[3][4], ARdouble width, ARMarkerInfo &candidate);
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Moves a candidate's corners onto the square's edges in the
+//				full-resolution luma plane. Each edge is searched along its
+//				normal for the strongest intensity step; a line is fitted to
+//				the hits in ideal coordinates, and the corners become the
+//				intersections of neighbouring lines.
+// OUTPUT: False if an edge could not be found, in which case the candidate
+//		   is left unchanged.
+// ARGUMENTS:
+//	- luma: Full-resolution luminance of the frame.
+//	- p_paramLTf: Lookup tables of the full-resolution camera parameters.
+//	- candidate: Candidate whose vertex, line and pos members are refined.
+//	- searchRadius: How far, in pixels, each edge may be from its estimate.
+//---------------------------------------------------------------------------//
+bool refineCandidate(const LumaPlane &luma, ARParamLTf* p_paramLTf, ARMarkerInfo &candidate, float searchRadius);
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Matches the candidate's interior against the loaded patterns
+//				using the full-resolution luma plane.
+// OUTPUT: True if a pattern matched.
+// ARGUMENTS:
+//	- p_arHandle: Supplies the pattern handle and matching settings.
+//	- luma: Full-resolution luminance of the frame.
+//	- p_paramLT: Full-resolution camera parameters.
+//	- candidate: Receives id, dir and cf (and their pattern counterparts).
+//	- p_bank: When given and not empty, matches against it instead of
+//	  ARToolKit's pattern handle.
+//	- p_hint: Patterns the candidate is expected to be, tried first by the
+//	  bank; ignored by ARToolKit's matching.
+//---------------------------------------------------------------------------//
+bool identifyCandidate(ARHandle* p_arHandle, LumaPlane &luma, ARParamLT* p_paramLT, ARMarkerInfo &candidate,
+	const PatternBank* p_bank = nullptr, const PatternHint* p_hint = nullptr);
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Empties a component's extremes.
+//---------------------------------------------------------------------------//
+void resetExtremes(ComponentExtremes &extremes);
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Adds pixels x0 to x1 (inclusive) of row y to a component.
+//---------------------------------------------------------------------------//
+void addRunToExtremes(ComponentExtremes &extremes, int x0, int x1, int y);
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Adds another component's pixels to a component.
+//---------------------------------------------------------------------------//
+void mergeExtremes(ComponentExtremes &into, const ComponentExtremes &from);
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Fits a quad to a dark component: the four extreme pixels
+//				spanning the largest area.
+// OUTPUT: False if the component touches the image border, is smaller
+//		   than minArea, or is not square-like: one of its other extremes
+//		   sticks out of the quad, or it fills too little or too much of it.
+// ARGUMENTS:
+//	- extremes: The component.
+//	- width, height: Size of the labeled image.
+//	- minArea: Smallest accepted component, in pixels.
+//	- quad: Receives vertex and area; previous is set to -1.
+// NOTES: The corners lie on the centres of the outermost pixels, so they
+//		  seed refineCandidate() rather than replace it.
+//---------------------------------------------------------------------------//
+bool fitComponentQuad(const ComponentExtremes &extremes, int width, int height, int minArea, ComponentQuad &quad);
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Builds an unidentified candidate from a quad found in the
+//				observed image.
+// OUTPUT: False if a corner could not be undistorted.
+// ARGUMENTS:
+//	- quad: Quad in observed full-frame coordinates.
+//	- p_paramLTf: Lookup tables of the full-resolution camera parameters.
+//	- candidate: Receives vertex, pos and area in ideal coordinates; id is
+//				 reset to -1.
+//---------------------------------------------------------------------------//
+bool quadToCandidate(const ComponentQuad &quad, ARParamLTf* p_paramLTf, ARMarkerInfo &candidate);
\ No newline at end of file
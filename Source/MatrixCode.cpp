@@ -0,0 +1,375 @@
+//================================================================================//
+// MatrixCode
+//	- Encoding and reading of the square barcodes printed inside matrix-code
+//	  markers.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//================================================================================//
+#include "MatrixCode.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Parsing.h"
+
+static const int MAX_DIMENSION = 6;
+static const int CELL_SAMPLES = 4;			// Samples along each side of a cell; only the inner two are used
+static const float MIN_CONTRAST = 30.0f;	// Grey levels between the darkest and lightest cells
+
+enum class CodeScheme
+{
+	RAW,
+	PARITY,
+	HAMMING
+};
+
+
+static CodeScheme getScheme(MatrixCodeType type)
+{
+	switch (type)
+	{
+	case MatrixCodeType::CODE_3x3_PARITY:	return CodeScheme::PARITY;
+	case MatrixCodeType::CODE_4x4_HAMMING:
+	case MatrixCodeType::CODE_5x5_HAMMING:
+	case MatrixCodeType::CODE_6x6_HAMMING:	return CodeScheme::HAMMING;
+	default:								return CodeScheme::RAW;
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+static inline bool isPowerOfTwo(int value)
+{
+	return (value & (value - 1)) == 0;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+static int getDataBits(MatrixCodeType type)
+{
+	int dimension = getMatrixCodeDimension(type);
+	int length = dimension * dimension - 4;
+
+	switch (getScheme(type))
+	{
+	case CodeScheme::PARITY:
+		return length - 1;
+	case CodeScheme::HAMMING:
+	{
+		// Positions 1 to length - 1, less those holding parity
+		int parityBits = 0;
+		for (int position = 1; position < length; position <<= 1)
+		{
+			parityBits++;
+		}
+		return length - 1 - parityBits;
+	}
+	default:
+		return length;
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+// Fills the codeword of an ID that fits the type.
+static void encodeBits(MatrixCodeType type, int id, std::vector<char> &bits)
+{
+	int length = (int)bits.size();
+	int dataBits = getDataBits(type);
+
+	switch (getScheme(type))
+	{
+	case CodeScheme::RAW:
+	case CodeScheme::PARITY:
+	{
+		char parity = 0;
+		for (int k = 0; k < dataBits; k++)
+		{
+			bits[k] = (id >> (dataBits - 1 - k)) & 1;
+			parity ^= bits[k];
+		}
+		if (dataBits < length)
+		{
+			bits[length - 1] = parity;
+		}
+		break;
+	}
+	case CodeScheme::HAMMING:
+	{
+		int next = dataBits - 1;
+		for (int position = 1; position < length; position++)
+		{
+			bits[position] = isPowerOfTwo(position) ? 0 : (id >> next--) & 1;
+		}
+		for (int parity = 1; parity < length; parity <<= 1)
+		{
+			for (int position = parity + 1; position < length; position++)
+			{
+				if (position & parity)
+				{
+					bits[parity] ^= bits[position];
+				}
+			}
+		}
+
+		bits[0] = 0;
+		for (int position = 1; position < length; position++)
+		{
+			bits[0] ^= bits[position];
+		}
+		break;
+	}
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+// Recovers the ID from a codeword; false if it is not valid.
+static bool decodeBits(MatrixCodeType type, std::vector<char> &bits, int &id, bool &corrected)
+{
+	int length = (int)bits.size();
+	int dataBits = getDataBits(type);
+	corrected = false;
+	id = 0;
+
+	switch (getScheme(type))
+	{
+	case CodeScheme::RAW:
+	case CodeScheme::PARITY:
+	{
+		char parity = 0;
+		for (int k = 0; k < dataBits; k++)
+		{
+			id = (id << 1) | bits[k];
+			parity ^= bits[k];
+		}
+		return dataBits == length || parity == bits[length - 1];
+	}
+	case CodeScheme::HAMMING:
+	{
+		// The syndrome is the position of a single error; the overall parity tells one error from two.
+		int syndrome = 0;
+		char parity = 0;
+		for (int position = 0; position < length; position++)
+		{
+			if (bits[position])
+			{
+				syndrome ^= position;
+				parity ^= 1;
+			}
+		}
+
+		if (parity == 0 && syndrome != 0)
+		{
+			return false;
+		}
+		if (parity != 0)
+		{
+			if (syndrome >= length)
+			{
+				return false;
+			}
+			bits[syndrome] ^= 1;
+			corrected = true;
+		}
+
+		for (int position = 1; position < length; position++)
+		{
+			if (!isPowerOfTwo(position))
+			{
+				id = (id << 1) | bits[position];
+			}
+		}
+		return true;
+	}
+	}
+
+	return false;
+}
+
+
+//================================================================================//
+
+
+MatrixCodeType parseMatrixCodeType(const std::string &text)
+{
+	std::string workingString = toLower(text);
+
+	if (workingString == "3x3") return MatrixCodeType::CODE_3x3;
+	else if (workingString == "3x3_parity") return MatrixCodeType::CODE_3x3_PARITY;
+	else if (workingString == "4x4") return MatrixCodeType::CODE_4x4;
+	else if (workingString == "4x4_hamming") return MatrixCodeType::CODE_4x4_HAMMING;
+	else if (workingString == "5x5") return MatrixCodeType::CODE_5x5;
+	else if (workingString == "5x5_hamming") return MatrixCodeType::CODE_5x5_HAMMING;
+	else if (workingString == "6x6_hamming") return MatrixCodeType::CODE_6x6_HAMMING;
+
+	return MatrixCodeType::INVALID;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+int getMatrixCodeDimension(MatrixCodeType type)
+{
+	switch (type)
+	{
+	case MatrixCodeType::CODE_3x3:
+	case MatrixCodeType::CODE_3x3_PARITY:	return 3;
+	case MatrixCodeType::CODE_4x4:
+	case MatrixCodeType::CODE_4x4_HAMMING:	return 4;
+	case MatrixCodeType::CODE_5x5:
+	case MatrixCodeType::CODE_5x5_HAMMING:	return 5;
+	case MatrixCodeType::CODE_6x6_HAMMING:	return 6;
+	default:								return 0;
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+int getMatrixCodeCapacity(MatrixCodeType type)
+{
+	return (getMatrixCodeDimension(type) == 0) ? 0 : 1 << getDataBits(type);
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool encodeMatrixCode(MatrixCodeType type, int id, std::vector<char> &cells)
+{
+	int dimension = getMatrixCodeDimension(type);
+	if (dimension == 0 || id < 0 || id >= getMatrixCodeCapacity(type))
+	{
+		return false;
+	}
+
+	std::vector<char> bits(dimension * dimension - 4, 0);
+	encodeBits(type, id, bits);
+
+	// Orientation corners, then the codeword row by row
+	int last = dimension - 1;
+	cells.assign(dimension * dimension, 0);
+	cells[0] = cells[last] = cells[last * dimension] = 1;
+	int next = 0;
+	for (int i = 0; i < cells.size(); i++)
+	{
+		if (i != 0 && i != last && i != last * dimension && i != last * dimension + last)
+		{
+			cells[i] = bits[next++];
+		}
+	}
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool readMatrixCode(const ubyte* p_luma, int width, int height, ARParamLTf* p_paramLTf, int imageProcMode,
+	ARdouble vertex[4][2], ARdouble pattRatio, MatrixCodeType type, int &id, int &dir, ARdouble &cf)
+{
+	int dimension = getMatrixCodeDimension(type);
+	if (dimension == 0)
+	{
+		return false;
+	}
+
+	// Row 0 of the patch runs from vertex 0 to vertex 1, column 0 from vertex 0 to vertex 3.
+	int pattSize = dimension * CELL_SAMPLES;
+	ARUint8 patch[MAX_DIMENSION * CELL_SAMPLES * MAX_DIMENSION * CELL_SAMPLES];
+	if (arPattGetImage2(imageProcMode, AR_TEMPLATE_MATCHING_MONO, pattSize, pattSize * AR_PATT_SAMPLE_FACTOR1,
+		(ARUint8*)p_luma, width, height, AR_PIXEL_FORMAT_MONO, p_paramLTf, vertex, pattRatio, patch) < 0)
+	{
+		return false;
+	}
+
+	// CELL VALUES from the inner samples, clear of the neighbouring cells
+	float values[MAX_DIMENSION * MAX_DIMENSION];
+	float darkest = 255.0f, lightest = 0.0f;
+	for (int r = 0; r < dimension; r++)
+	{
+		for (int c = 0; c < dimension; c++)
+		{
+			const ARUint8* p_cell = patch + (r * CELL_SAMPLES + 1) * pattSize + c * CELL_SAMPLES + 1;
+			float value = (p_cell[0] + p_cell[1] + p_cell[pattSize] + p_cell[pattSize + 1]) * 0.25f;
+			values[r * dimension + c] = value;
+			darkest = std::min(darkest, value);
+			lightest = std::max(lightest, value);
+		}
+	}
+	if (lightest - darkest < MIN_CONTRAST)
+	{
+		return false;
+	}
+	float threshold = (darkest + lightest) * 0.5f;
+
+	// ROTATION: the one light corner is the code's bottom right
+	int last = dimension - 1;
+	const int cornerCells[4] = { 0, last, last * dimension + last, last * dimension }; // At vertices 0 to 3
+	int lightCorner = -1;
+	for (int v = 0; v < 4; v++)
+	{
+		if (values[cornerCells[v]] >= threshold)
+		{
+			if (lightCorner >= 0)
+			{
+				return false;
+			}
+			lightCorner = v;
+		}
+	}
+	if (lightCorner < 0)
+	{
+		return false;
+	}
+	dir = (6 - lightCorner) % 4;
+
+	// CODEWORD, read in the code's own orientation; each quarter turn maps (r, c) to (c, last - r).
+	std::vector<char> bits;
+	bits.reserve(dimension * dimension - 4);
+	float margin = 1.0f;
+	for (int r = 0; r < dimension; r++)
+	{
+		for (int c = 0; c < dimension; c++)
+		{
+			int pr = r, pc = c;
+			for (int turn = 0; turn < (4 - dir) % 4; turn++)
+			{
+				int t = pr;
+				pr = pc;
+				pc = last - t;
+			}
+
+			float value = values[pr * dimension + pc];
+			margin = std::min(margin, std::abs(value - threshold) / ((lightest - darkest) * 0.5f));
+
+			bool corner = (r == 0 || r == last) && (c == 0 || c == last);
+			if (!corner)
+			{
+				bits.push_back(value < threshold ? 1 : 0);
+			}
+		}
+	}
+
+	bool corrected;
+	if (!decodeBits(type, bits, id, corrected))
+	{
+		return false;
+	}
+
+	cf = (ARdouble)(corrected ? margin * 0.75f : margin);
+	return true;
+}
\ No newline at end of file
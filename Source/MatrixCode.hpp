@@ -0,0 +1,85 @@
+//================================================================================//
+// MatrixCode
+//	- Encoding and reading of the square barcodes printed inside matrix-code
+//	  markers.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//--------------------------------------------------------------------------------//
+// NOTE: A code is an N x N grid of cells filling the marker's interior (the
+//		 same pattern ratio glyphs use). Three corner cells are dark and the
+//		 bottom right one light, which fixes the rotation; the remaining
+//		 N^2 - 4 cells are the codeword, read row by row, most significant bit
+//		 first. Codewords carry the ID as is, with an even parity bit, or as
+//		 an extended Hamming code (bit 0 the overall parity, Hamming positions
+//		 1 to N^2 - 5), which corrects one misread cell and rejects two.
+//		 Rotations follow ARToolKit's dir: with rotation dir, the code's top
+//		 left corner lies at vertex (4 - dir) % 4 of the square.
+//================================================================================//
+#pragma once
+
+#include<string>
+#include<vector>
+
+#include<AR/ar.h>
+
+#include "TypeDef.hpp"
+
+
+enum class MatrixCodeType
+{
+	CODE_3x3,				// 5 bits, 32 IDs
+	CODE_3x3_PARITY,		// 4 bits and parity, 16 IDs
+	CODE_4x4,				// 12 bits, 4096 IDs
+	CODE_4x4_HAMMING,		// 7 bits, 128 IDs
+	CODE_5x5,				// 21 bits
+	CODE_5x5_HAMMING,		// 15 bits, 32768 IDs
+	CODE_6x6_HAMMING,		// 26 bits
+	INVALID = -1			// Used as a default value for the function parseMatrixCodeType
+};
+
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Parses a code type's name ("4x4_hamming", ...), ignoring case.
+//---------------------------------------------------------------------------//
+MatrixCodeType parseMatrixCodeType(const std::string &text);
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Cells along each side of a code type's grid, or 0 if invalid.
+//---------------------------------------------------------------------------//
+int getMatrixCodeDimension(MatrixCodeType type);
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Number of IDs a code type holds; valid IDs are 0 to this - 1.
+//---------------------------------------------------------------------------//
+int getMatrixCodeCapacity(MatrixCodeType type);
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Lays out the grid of an ID, as printed.
+// OUTPUT: False if the ID does not fit the code type.
+// ARGUMENTS:
+//	- type, id: The code.
+//	- cells: Receives N x N flags, row by row from the top left; nonzero
+//	  cells are dark.
+//---------------------------------------------------------------------------//
+bool encodeMatrixCode(MatrixCodeType type, int id, std::vector<char> &cells);
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Reads the code inside a square of a luminance plane.
+// OUTPUT: False if the interior could not be sampled, has too little
+//		   contrast, has no single light corner, or its codeword is not
+//		   valid for the code type.
+// ARGUMENTS:
+//	- p_luma, width, height: Full-resolution luminance of the frame.
+//	- p_paramLTf: Lookup tables of the full-resolution camera parameters.
+//	- imageProcMode: AR_IMAGE_PROC_FRAME_IMAGE or _FIELD_IMAGE.
+//	- vertex: Corners in ideal coordinates, as in ARMarkerInfo.
+//	- pattRatio: Width of the grid over the width of the marker.
+//	- type: Code type to read the grid as.
+//	- id, dir: Receive the ID and rotation.
+//	- cf: Receives the confidence: how far the least certain cell is from
+//	  the threshold, as a fraction of half the contrast, and three
+//	  quarters of that when a cell was corrected.
+//---------------------------------------------------------------------------//
+bool readMatrixCode(const ubyte* p_luma, int width, int height, ARParamLTf* p_paramLTf, int imageProcMode,
+	ARdouble vertex[4][2], ARdouble pattRatio, MatrixCodeType type, int &id, int &dir, ARdouble &cf);
\ No newline at end of file
@@ -0,0 +1,41 @@
+//================================================================================//
+// MatrixCodeMarker
+//	- Class to represent a square marker identified by the barcode inside it.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//================================================================================//
+#include "MatrixCodeMarker.hpp"
+
+MatrixCodeMarker::MatrixCodeMarker(int barcodeID, MatrixCodeType codeType, const std::string &name)
+{
+	if (getMatrixCodeDimension(codeType) == 0)
+	{
+		throw Error::Exception("Unknown matrix code type");
+	}
+	if (barcodeID < 0 || barcodeID >= getMatrixCodeCapacity(codeType))
+	{
+		throw Error::Exception("Barcode ID " + numberToString(barcodeID) + " does not fit the matrix code type");
+	}
+
+	m_barcodeID = barcodeID;
+	m_codeType = codeType;
+
+	if (name.empty())
+	{
+		m_name = "Marker_" + numberToString(this->getMarkerID());
+	}
+	else
+	{
+		m_name = name;
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+MatrixCodeMarker::~MatrixCodeMarker()
+{
+	
+}
\ No newline at end of file
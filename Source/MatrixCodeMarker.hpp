@@ -0,0 +1,32 @@
+//================================================================================//
+// MatrixCodeMarker
+//	- Class to represent a square marker identified by the barcode inside it.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//================================================================================//
+#pragma once
+
+// Parent Class
+#include "ARMarker.hpp"
+
+#include<string>
+
+#include "MatrixCode.hpp"
+#include "Util.hpp"
+
+class MatrixCodeMarker : public ARMarker
+{
+public:
+	MatrixCodeMarker(int barcodeID, MatrixCodeType codeType, const std::string &name = "");
+	~MatrixCodeMarker();
+
+	inline MarkerType getType() { return MarkerType::MATRIX_CODE; }
+
+	inline int getBarcodeID() const { return m_barcodeID; }
+	inline MatrixCodeType getCodeType() const { return m_codeType; }
+
+protected:
+	int				m_barcodeID;
+	MatrixCodeType	m_codeType;
+};
\ No newline at end of file
@@ -0,0 +1,222 @@
+//================================================================================//
+// PatternBank
+//	- Every loaded glyph pattern, in all four rotations, as normalised
+//	  templates identified by vectorised cross-correlation.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//================================================================================//
+#include "PatternBank.hpp"
+
+#include <cmath>
+
+#include "Telemetry.hpp"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define PATTERN_BANK_X86
+#include <xmmintrin.h>
+#endif
+
+static const int MAX_PATT_SIZE = 64;		// ARToolKit's AR_PATT_SIZE1_MAX
+static const float MIN_CONTRAST = 15.0f;	// Grey levels of deviation per pattern row, as ARToolKit requires
+
+
+PatternBank::PatternBank()
+{
+	m_pattSize = 0;
+	m_rowLength = 0;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool PatternBank::build(const ARPattHandle* p_patternHandle)
+{
+	clear();
+	if (p_patternHandle == NULL || p_patternHandle->pattSize <= 0 || p_patternHandle->pattSize > MAX_PATT_SIZE)
+	{
+		return false;
+	}
+
+	m_pattSize = p_patternHandle->pattSize;
+	int pixelCount = m_pattSize * m_pattSize;
+	m_rowLength = (pixelCount + 3) & ~3;
+	m_rowOfCode.assign((size_t)p_patternHandle->patt_num_max * 4, -1);
+
+	for (int k = 0; k < p_patternHandle->patt_num_max; k++)
+	{
+		if (p_patternHandle->pattf[k] != 1) continue; // Empty or deactivated
+
+		for (int dir = 0; dir < 4; dir++)
+		{
+			const int* p_pattern = p_patternHandle->pattBW[k * 4 + dir];
+			float length = (float)p_patternHandle->pattpowBW[k * 4 + dir];
+			if (length <= 0.0f) continue;
+
+			size_t row = m_templates.size();
+			m_templates.resize(row + m_rowLength, 0.0f);
+			for (int i = 0; i < pixelCount; i++)
+			{
+				m_templates[row + i] = (float)p_pattern[i] / length;
+			}
+			m_rowOfCode[k * 4 + dir] = (int)m_codes.size();
+			m_codes.push_back(k * 4 + dir);
+		}
+	}
+
+	return !isEmpty();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void PatternBank::clear()
+{
+	m_templates.clear();
+	m_codes.clear();
+	m_rowOfCode.clear();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool PatternBank::identify(const LumaPlane &luma, ARParamLTf* p_paramLTf, int imageProcMode, ARdouble vertex[4][2],
+	ARdouble pattRatio, int &code, int &dir, ARdouble &cf, const PatternHint* p_hint) const
+{
+	if (isEmpty())
+	{
+		return false;
+	}
+
+	ARUint8 patch[MAX_PATT_SIZE * MAX_PATT_SIZE];
+	if (arPattGetImage2(imageProcMode, AR_TEMPLATE_MATCHING_MONO, m_pattSize, m_pattSize * AR_PATT_SAMPLE_FACTOR1,
+		(ARUint8*)luma.getPixels(), luma.getWidth(), luma.getHeight(), AR_PIXEL_FORMAT_MONO, p_paramLTf, vertex, pattRatio, patch) < 0)
+	{
+		return false;
+	}
+
+	// MEAN-NORMALISED INTERIOR, inverted as ARToolKit's templates are
+	int pixelCount = m_pattSize * m_pattSize;
+	float input[MAX_PATT_SIZE * MAX_PATT_SIZE];
+	float mean = 0.0f;
+	for (int i = 0; i < pixelCount; i++)
+	{
+		mean += (float)(255 - patch[i]);
+	}
+	mean /= (float)pixelCount;
+
+	float power = 0.0f;
+	for (int i = 0; i < pixelCount; i++)
+	{
+		input[i] = (float)(255 - patch[i]) - mean;
+		power += input[i] * input[i];
+	}
+	for (int i = pixelCount; i < m_rowLength; i++)
+	{
+		input[i] = 0.0f;
+	}
+
+	power = sqrtf(power);
+	if (power / (float)m_pattSize < MIN_CONTRAST)
+	{
+		return false;
+	}
+
+	int best = -1;
+	float bestScore = -2.0f;
+	unsigned long long comparisons = 0;
+	Telemetry &telemetry = getTelemetry();
+
+	// EXPECTED ROWS
+	if (p_hint != nullptr && !p_hint->codes.empty())
+	{
+		for (int code : p_hint->codes)
+		{
+			int row = (code >= 0 && code < m_rowOfCode.size()) ? m_rowOfCode[code] : -1;
+			if (row < 0) continue;
+
+			float score = dot(&m_templates[(size_t)row * m_rowLength], input, m_rowLength);
+			comparisons++;
+			if (score > bestScore)
+			{
+				bestScore = score;
+				best = row;
+			}
+		}
+
+		if (best >= 0 && (ARdouble)(bestScore / power) > p_hint->minConfidence)
+		{
+			telemetry.count(TelemetryCounter::HINTED_IDENTIFICATIONS);
+		}
+		else
+		{
+			telemetry.count(TelemetryCounter::HINT_FALLBACKS);
+			best = -1;
+			bestScore = -2.0f; // The hinted rows are searched again with the rest.
+		}
+	}
+
+	// BEST ROW of the whole bank
+	if (best < 0)
+	{
+		for (int row = 0; row < m_codes.size(); row++)
+		{
+			float score = dot(&m_templates[(size_t)row * m_rowLength], input, m_rowLength);
+			if (score > bestScore)
+			{
+				bestScore = score;
+				best = row;
+			}
+		}
+		comparisons += m_codes.size();
+	}
+	telemetry.count(TelemetryCounter::PATTERN_COMPARISONS, comparisons);
+
+	if (best < 0)
+	{
+		return false;
+	}
+
+	code = m_codes[best] / 4;
+	dir = m_codes[best] % 4;
+	cf = (ARdouble)(bestScore / power);
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+float PatternBank::dot(const float* p_a, const float* p_b, int length)
+{
+#ifdef PATTERN_BANK_X86
+	// Two accumulators hide the latency of the adds.
+	__m128 sum0 = _mm_setzero_ps();
+	__m128 sum1 = _mm_setzero_ps();
+	int i = 0;
+	for (; i + 8 <= length; i += 8)
+	{
+		sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(p_a + i), _mm_loadu_ps(p_b + i)));
+		sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(p_a + i + 4), _mm_loadu_ps(p_b + i + 4)));
+	}
+	for (; i < length; i += 4)
+	{
+		sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(p_a + i), _mm_loadu_ps(p_b + i)));
+	}
+
+	float lanes[4];
+	_mm_storeu_ps(lanes, _mm_add_ps(sum0, sum1));
+	return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#else
+	float sum = 0.0f;
+	for (int i = 0; i < length; i++)
+	{
+		sum += p_a[i] * p_b[i];
+	}
+	return sum;
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+//================================================================================//
+// PatternBank
+//	- Every loaded glyph pattern, in all four rotations, as normalised
+//	  templates identified by vectorised cross-correlation.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//--------------------------------------------------------------------------------//
+// NOTE: Built from the grey templates ARToolKit keeps for
+//		 AR_TEMPLATE_MATCHING_MONO, which are already mean-subtracted; the
+//		 bank scales each to unit length and packs them into one contiguous
+//		 matrix. A candidate's interior is sampled once, mean-normalised, and
+//		 correlated against every row 4 floats at a time with SSE, so each
+//		 extra pattern costs a few dozen multiply-adds next to the sampling.
+//		 Scores equal ARToolKit's confidence values. A hint narrows the
+//		 correlation to the rows a candidate is expected to match; the rest
+//		 are only tried if none of those reaches the hint's confidence.
+//		 identify() is const and may be called from several threads at once.
+//================================================================================//
+#pragma once
+
+#include<vector>
+
+#include<AR/ar.h>
+
+#include "LumaPlane.hpp"
+
+
+// Rows a candidate is expected to match, tried before the rest of the bank.
+struct PatternHint
+{
+	std::vector<int> codes;		// Pattern ID * 4 + rotation
+	ARdouble minConfidence;		// An expected row scoring above this ends the search
+};
+
+
+class PatternBank
+{
+public:
+	PatternBank();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Replaces the bank with the active patterns of a handle.
+	// OUTPUT: False if it holds no patterns; the bank is then empty.
+	// INPUT:
+	//	* p_patternHandle: Patterns loaded with arPattLoad().
+	// MUTATES:
+	//	- m_templates, m_codes, m_rowOfCode, m_pattSize
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool build(const ARPattHandle* p_patternHandle);
+	void clear();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Finds the pattern and rotation that best match the
+	//				interior of a quad.
+	// OUTPUT: False if the interior could not be sampled or has too little
+	//		   contrast to identify.
+	// INPUT:
+	//	* luma: Full-resolution luminance of the frame.
+	//	* p_paramLTf: Lookup tables of the full-resolution camera parameters.
+	//	* imageProcMode: AR_IMAGE_PROC_FRAME_IMAGE or _FIELD_IMAGE.
+	//	* vertex: Corners in ideal coordinates, as in ARMarkerInfo.
+	//	* pattRatio: Width of the pattern over the width of the marker.
+	//	* code, dir, cf: Receive the pattern ID, rotation and confidence.
+	//	* p_hint: When given, its rows are correlated first and the rest
+	//	  of the bank only if none of them is confident enough.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool identify(const LumaPlane &luma, ARParamLTf* p_paramLTf, int imageProcMode, ARdouble vertex[4][2],
+		ARdouble pattRatio, int &code, int &dir, ARdouble &cf, const PatternHint* p_hint = nullptr) const;
+
+	// GETTERS
+	inline bool isEmpty() const { return m_codes.empty(); }
+	inline unsigned int getTemplateCount() const { return (unsigned int)m_codes.size(); }
+
+private:
+	std::vector<float> m_templates;	// One unit-length row of m_rowLength floats per pattern and rotation
+	std::vector<int> m_codes;		// Per row: pattern ID * 4 + rotation
+	std::vector<int> m_rowOfCode;	// Per pattern ID * 4 + rotation: its row, or -1
+	int m_pattSize;					// Patterns are m_pattSize x m_pattSize
+	int m_rowLength;				// m_pattSize^2, padded to a multiple of 4 with zeros
+
+	static float dot(const float* p_a, const float* p_b, int length);
+};
\ No newline at end of file
@@ -0,0 +1,452 @@
+//================================================================================//
+// RecordedFrameSource
+//	- Frame source that replays previously captured frames from disk.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//================================================================================//
+#include "RecordedFrameSource.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+#include "Parsing.h"
+
+
+RecordedFrameSource::RecordedFrameSource(const std::string &path, AR_PIXEL_FORMAT pixelFormat, int width, int height)
+{
+	m_path = path;
+	m_pixelFormat = pixelFormat;
+	m_width = width;
+	m_height = height;
+
+	m_isContainer = (path.find('%') == std::string::npos);
+	m_looping = true;
+	m_running = false;
+	m_stepRequested = false;
+	m_frameRate = 30.0f;
+
+	m_firstFileNumber = 0;
+	m_frameCount = 0;
+	m_currentFrame = -1;
+	m_deliveredFrame = -1;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+RecordedFrameSource::~RecordedFrameSource()
+{
+	close();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool RecordedFrameSource::open()
+{
+	if (m_pixelFormat == AR_PIXEL_FORMAT_INVALID)
+	{
+		return false;
+	}
+
+	if (toLower(m_path.substr(m_path.find_last_of('.') + 1)) == "arsession")
+	{
+		// SESSION RECORDING
+		if (!m_session.open(m_path))
+		{
+			return false;
+		}
+
+		m_width = m_session.getWidth();
+		m_height = m_session.getHeight();
+		m_pixelFormat = m_session.getPixelFormat();
+		m_frameCount = m_session.getFrameCount();
+	}
+	else if (m_isContainer)
+	{
+		// SINGLE RAW CONTAINER
+		if (m_width <= 0 || m_height <= 0)
+		{
+			std::cout << "RECORDED FRAME SOURCE: Raw containers need a width and height." << std::endl;
+			return false;
+		}
+
+		m_container.open(m_path.c_str(), std::ios::in | std::ios::binary);
+		if (!m_container.good())
+		{
+			return false;
+		}
+
+		std::streamoff frameSize = (std::streamoff)m_width * m_height * arUtilGetPixelSize(m_pixelFormat);
+		m_container.seekg(0, std::ios::end);
+		m_frameCount = (int)(m_container.tellg() / frameSize);
+		m_container.seekg(0, std::ios::beg);
+	}
+	else
+	{
+		// NUMBERED SEQUENCE
+		std::ifstream probe(getFrameFileName(0).c_str(), std::ios::in | std::ios::binary);
+		if (!probe.good())
+		{
+			m_firstFileNumber = 1;
+		}
+		probe.close();
+
+		while (true)
+		{
+			probe.open(getFrameFileName(m_frameCount).c_str(), std::ios::in | std::ios::binary);
+			if (!probe.good())
+			{
+				break;
+			}
+
+			// Dimensions of a PPM sequence come from its first frame.
+			if (m_frameCount == 0 && toLower(m_path.substr(m_path.find_last_of('.') + 1)) == "ppm")
+			{
+				int width, height;
+				if (!readPPMHeader(probe, width, height))
+				{
+					return false;
+				}
+				m_width = width;
+				m_height = height;
+			}
+
+			probe.close();
+			m_frameCount++;
+		}
+
+		if (m_width <= 0 || m_height <= 0)
+		{
+			std::cout << "RECORDED FRAME SOURCE: Raw frame sequences need a width and height." << std::endl;
+			return false;
+		}
+	}
+
+	if (m_frameCount == 0)
+	{
+		std::cout << "RECORDED FRAME SOURCE: No frames found at \"" << m_path << "\"." << std::endl;
+		return false;
+	}
+
+	m_frameBuffer.resize(m_width * m_height * arUtilGetPixelSize(m_pixelFormat));
+	m_currentFrame = -1;
+	m_deliveredFrame = -1;
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void RecordedFrameSource::close()
+{
+	m_running = false;
+
+	if (m_container.is_open())
+	{
+		m_container.close();
+	}
+	m_session.close();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool RecordedFrameSource::startCapture()
+{
+	m_running = true;
+	m_stepRequested = true; // Always show the first frame.
+	m_deliveredFrame = -1;
+	m_startTime = std::chrono::steady_clock::now();
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void RecordedFrameSource::stopCapture()
+{
+	m_running = false;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void RecordedFrameSource::step()
+{
+	m_stepRequested = true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+ARUint8* RecordedFrameSource::getImage()
+{
+	if (!m_running)
+	{
+		return NULL;
+	}
+
+	int sequence = nextFrameIndex();
+	if (sequence < 0 || sequence == m_deliveredFrame)
+	{
+		return NULL; // No new frame, same as a camera between captures.
+	}
+
+	int index = sequence % m_frameCount;
+	if (index != m_currentFrame && !loadFrame(index))
+	{
+		return NULL;
+	}
+
+	m_deliveredFrame = sequence;
+	markNewFrame();
+	return m_frameBuffer.data();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+int RecordedFrameSource::nextFrameIndex()
+{
+	int sequence = m_deliveredFrame;
+
+	switch (m_playbackMode)
+	{
+	case PlaybackMode::REAL_TIME:
+	{
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - m_startTime;
+		sequence = (int)(elapsed.count() * m_frameRate);
+	}
+		break;
+
+	case PlaybackMode::MAX_SPEED:
+		sequence = m_deliveredFrame + 1;
+		break;
+
+	case PlaybackMode::SINGLE_STEP:
+		if (m_stepRequested.exchange(false))
+		{
+			sequence = m_deliveredFrame + 1;
+		}
+		break;
+
+	default:
+		break; // Holds the current frame
+	}
+
+	if (!m_looping && sequence >= m_frameCount)
+	{
+		return -1; // End of recording
+	}
+
+	return sequence;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool RecordedFrameSource::loadFrame(int index)
+{
+	bool success;
+
+	if (m_session.isOpen())
+	{
+		// Sequential playback only applies one delta on top of the current frame.
+		success = m_session.decodeFrame(index, m_frameBuffer.data(), m_currentFrame);
+	}
+	else if (m_isContainer)
+	{
+		m_container.clear();
+		m_container.seekg((std::streamoff)index * m_frameBuffer.size(), std::ios::beg);
+		m_container.read((char*)m_frameBuffer.data(), m_frameBuffer.size());
+		success = m_container.good();
+	}
+	else
+	{
+		success = readFrameFile(getFrameFileName(index));
+	}
+
+	if (success)
+	{
+		m_currentFrame = index;
+	}
+	else
+	{
+		m_currentFrame = -1; // The buffer may hold a partially decoded frame.
+		std::cout << "RECORDED FRAME SOURCE: Failed to read frame " << index << "." << std::endl;
+	}
+
+	return success;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+std::string RecordedFrameSource::getFrameFileName(int index) const
+{
+	char fileName[1024];
+	snprintf(fileName, sizeof(fileName), m_path.c_str(), index + m_firstFileNumber);
+	return std::string(fileName);
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool RecordedFrameSource::readFrameFile(const std::string &fileName)
+{
+	std::ifstream file(fileName.c_str(), std::ios::in | std::ios::binary);
+	if (!file.good())
+	{
+		return false;
+	}
+
+	if (toLower(fileName.substr(fileName.find_last_of('.') + 1)) != "ppm")
+	{
+		// RAW FRAME
+		file.read((char*)m_frameBuffer.data(), m_frameBuffer.size());
+		return file.good();
+	}
+
+	// PPM FRAME
+	int width, height;
+	if (!readPPMHeader(file, width, height) || width != m_width || height != m_height)
+	{
+		return false;
+	}
+
+	if (m_pixelFormat == AR_PIXEL_FORMAT_RGB)
+	{
+		file.read((char*)m_frameBuffer.data(), m_frameBuffer.size());
+		return file.good();
+	}
+
+	m_fileBuffer.resize(width * height * 3);
+	file.read((char*)m_fileBuffer.data(), m_fileBuffer.size());
+	if (!file.good())
+	{
+		return false;
+	}
+
+	return convertRGBToPixelFormat(m_fileBuffer.data(), m_frameBuffer.data(), width * height, m_pixelFormat);
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool RecordedFrameSource::readPPMHeader(std::ifstream &file, int &width, int &height)
+{
+	std::string token;
+	int values[3];
+	char c;
+
+	file >> token;
+	if (token != "P6")
+	{
+		return false;
+	}
+
+	// WIDTH, HEIGHT, AND MAXIMUM VALUE, WITH POSSIBLE COMMENTS BETWEEN THEM
+	for (int i = 0; i < 3; i++)
+	{
+		file >> std::ws;
+		while (file.peek() == '#')
+		{
+			std::getline(file, token);
+			file >> std::ws;
+		}
+
+		file >> values[i];
+		if (!file.good())
+		{
+			return false;
+		}
+	}
+
+	file.get(c); // Single whitespace character before the pixel data
+
+	width = values[0];
+	height = values[1];
+
+	return (values[2] == 255 && width > 0 && height > 0);
+}
+
+
+//================================================================================//
+
+
+bool convertRGBToPixelFormat(const ubyte* p_source, ubyte* p_destination, int pixelCount, AR_PIXEL_FORMAT format)
+{
+	const ubyte* s = p_source;
+	ubyte* d = p_destination;
+
+	switch (format)
+	{
+	case AR_PIXEL_FORMAT_RGB:
+		memcpy(d, s, pixelCount * 3);
+		break;
+
+	case AR_PIXEL_FORMAT_BGR:
+		for (int i = 0; i < pixelCount; i++, s += 3, d += 3)
+		{
+			d[0] = s[2]; d[1] = s[1]; d[2] = s[0];
+		}
+		break;
+
+	case AR_PIXEL_FORMAT_RGBA:
+		for (int i = 0; i < pixelCount; i++, s += 3, d += 4)
+		{
+			d[0] = s[0]; d[1] = s[1]; d[2] = s[2]; d[3] = 255;
+		}
+		break;
+
+	case AR_PIXEL_FORMAT_BGRA:
+		for (int i = 0; i < pixelCount; i++, s += 3, d += 4)
+		{
+			d[0] = s[2]; d[1] = s[1]; d[2] = s[0]; d[3] = 255;
+		}
+		break;
+
+	case AR_PIXEL_FORMAT_ARGB:
+		for (int i = 0; i < pixelCount; i++, s += 3, d += 4)
+		{
+			d[0] = 255; d[1] = s[0]; d[2] = s[1]; d[3] = s[2];
+		}
+		break;
+
+	case AR_PIXEL_FORMAT_ABGR:
+		for (int i = 0; i < pixelCount; i++, s += 3, d += 4)
+		{
+			d[0] = 255; d[1] = s[2]; d[2] = s[1]; d[3] = s[0];
+		}
+		break;
+
+	case AR_PIXEL_FORMAT_MONO:
+		for (int i = 0; i < pixelCount; i++, s += 3, d++)
+		{
+			*d = (ubyte)((77 * s[0] + 150 * s[1] + 29 * s[2]) >> 8);
+		}
+		break;
+
+	default:
+		return false;
+	}
+
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+//================================================================================//
+// RecordedFrameSource
+//	- Frame source that replays previously captured frames from disk.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//--------------------------------------------------------------------------------//
+// NOTE: Three layouts are supported:
+//		 - A numbered sequence of binary PPM (P6) or headerless raw files, given as
+//		   a printf-style pattern (e.g. "Recording/frame_%05d.ppm").
+//		 - A single raw container (*.raw) holding back-to-back frames with no
+//		   header; width, height, and pixel format must then be supplied.
+//		 - A session recording (*.arsession) written by SessionRecorder; its
+//		   header supplies the dimensions and pixel format.
+//		 PPM frames are converted to the requested pixel format on load. Raw
+//		 frames must already be stored in it.
+//================================================================================//
+#pragma once
+
+#include<string>
+#include<vector>
+#include<fstream>
+#include<chrono>
+#include<atomic>
+
+#include "FrameSource.hpp"
+#include "SessionRecording.hpp"
+
+class RecordedFrameSource : public FrameSource
+{
+public:
+	RecordedFrameSource(const std::string &path, AR_PIXEL_FORMAT pixelFormat = AR_PIXEL_FORMAT_RGB, int width = -1, int height = -1);
+	~RecordedFrameSource();
+
+	bool open();
+	void close();
+
+	bool startCapture();
+	void stopCapture();
+
+	ARUint8* getImage();
+
+	void step();
+
+	// GETTERS AND SETTERS
+	inline void setPlaybackMode(PlaybackMode mode) { m_playbackMode = mode; }
+	inline void setFrameRate(float framesPerSecond) { m_frameRate = framesPerSecond; }
+	inline float getFrameRate() const { return m_frameRate; }
+	inline void setLooping(bool loop) { m_looping = loop; }
+	inline int getFrameCount() const { return m_frameCount; }
+	inline int getFrameIndex() const { return m_currentFrame; }
+	inline const SessionReader* getSessionReader() const { return m_session.isOpen() ? &m_session : NULL; } // NULL unless replaying a session
+
+private:
+	std::string m_path;
+	bool m_isContainer;		// True when m_path is a single raw file, false when it is a pattern.
+	bool m_looping;
+	bool m_running;
+	std::atomic<bool> m_stepRequested; // Set from the UI thread when capture is threaded.
+	float m_frameRate;		// Used for PlaybackMode::REAL_TIME
+
+	int m_firstFileNumber;	// Numbered sequences may start at 0 or 1.
+	int m_frameCount;
+	int m_currentFrame;		// Index of the frame in m_frameBuffer, -1 if none.
+	int m_deliveredFrame;	// Index of the last frame returned by getImage().
+
+	std::ifstream m_container;
+	SessionReader m_session;
+	std::vector<ubyte> m_frameBuffer;
+	std::vector<ubyte> m_fileBuffer; // Scratch space for PPM decoding.
+	std::chrono::steady_clock::time_point m_startTime;
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Chooses the index of the frame that should be visible
+	//				now, according to the playback mode.
+	// OUTPUT: Frame index, or -1 when playback has finished.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	int nextFrameIndex();
+
+	// Reads the frame with the provided index into m_frameBuffer.
+	bool loadFrame(int index);
+
+	std::string getFrameFileName(int index) const;
+	bool readFrameFile(const std::string &fileName);
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Parses a binary PPM header.
+	// OUTPUT: True if the header is a valid 8-bit P6 header.
+	// INPUT:
+	//	* file: Stream positioned at the start of the file. On return it
+	//	  is positioned at the first byte of pixel data.
+	//	* width, height: Receive the image dimensions.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static bool readPPMHeader(std::ifstream &file, int &width, int &height);
+};
+
+
+//================================================================================//
+
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Converts packed RGB pixels to another AR pixel format.
+// OUTPUT: False if the destination format is not supported.
+// ARGUMENTS:
+//	- p_source: Packed RGB pixels.
+//	- p_destination: Buffer large enough for pixelCount pixels in format.
+//	- pixelCount: Number of pixels to convert.
+//	- format: Destination pixel format.
+//---------------------------------------------------------------------------//
+bool convertRGBToPixelFormat(const ubyte* p_source, ubyte* p_destination, int pixelCount, AR_PIXEL_FORMAT format);
\ No newline at end of file
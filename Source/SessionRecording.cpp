@@ -0,0 +1,745 @@
+//================================================================================//
+// SessionRecording
+//	- Binary recording and replay of everything the tracker saw and produced.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//================================================================================//
+#include "SessionRecording.hpp"
+
+#include <cstring>
+#include <iostream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "Parsing.h"
+
+
+static const char SESSION_MAGIC[4] = { 'A', 'R', 'S', 'S' };
+static const uint32_t SESSION_VERSION = 1;
+
+
+//================================================================================//
+
+
+SessionRecorder::SessionRecorder()
+{
+	memset(&m_header, 0, sizeof(m_header));
+	m_compress = true;
+	m_frameSize = 0;
+	m_lastKeyframe = 0;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+SessionRecorder::~SessionRecorder()
+{
+	close();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool SessionRecorder::open(const std::string &path, int width, int height, AR_PIXEL_FORMAT pixelFormat,
+	unsigned int keyframeInterval, bool compress)
+{
+	close();
+
+	if (width <= 0 || height <= 0 || pixelFormat == AR_PIXEL_FORMAT_INVALID)
+	{
+		return false;
+	}
+
+	m_file.open(path.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!m_file.good())
+	{
+		std::cout << "SESSION RECORDER: Couldn't create \"" << path << "\"." << std::endl;
+		return false;
+	}
+
+	memset(&m_header, 0, sizeof(m_header));
+	memcpy(m_header.magic, SESSION_MAGIC, sizeof(SESSION_MAGIC));
+	m_header.version = SESSION_VERSION;
+	m_header.width = width;
+	m_header.height = height;
+	m_header.pixelFormat = pixelFormat;
+	m_header.bytesPerPixel = arUtilGetPixelSize(pixelFormat);
+	m_header.keyframeInterval = (keyframeInterval > 0) ? keyframeInterval : 1;
+
+	m_compress = compress;
+	m_frameSize = width * height * m_header.bytesPerPixel;
+	m_lastKeyframe = 0;
+
+	m_index.clear();
+	m_previousFrame.assign(m_frameSize, 0);
+
+	m_file.write((const char*)&m_header, sizeof(m_header));
+	return m_file.good();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void SessionRecorder::close()
+{
+	if (!m_file.is_open())
+	{
+		return;
+	}
+
+	// INDEX
+	m_header.indexOffset = (uint64_t)m_file.tellp();
+	m_header.frameCount = (uint32_t)m_index.size();
+	if (!m_index.empty())
+	{
+		m_index.back().size = (uint32_t)(m_header.indexOffset - m_index.back().offset);
+	}
+	writeChunk(SESSION_CHUNK_INDEX, m_index.data(), (uint32_t)(m_index.size() * sizeof(SessionIndexEntry)));
+
+	// FINAL HEADER
+	m_file.seekp(0, std::ios::beg);
+	m_file.write((const char*)&m_header, sizeof(m_header));
+	m_file.close();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool SessionRecorder::writeFrame(const FramePacket &packet)
+{
+	if (!m_file.is_open() || packet.p_image == NULL)
+	{
+		return false;
+	}
+
+	Image& frame = *packet.p_image;
+	if (frame.getWidth() * frame.getHeight() * frame.getColorDepth() != m_frameSize || !frame.isPacked())
+	{
+		return false;
+	}
+
+	SessionIndexEntry entry;
+	entry.offset = (uint64_t)m_file.tellp();
+	entry.size = 0;
+
+	if (!m_index.empty())
+	{
+		m_index.back().size = (uint32_t)(entry.offset - m_index.back().offset);
+	}
+
+	// FRAME
+	uint32_t frameIndex = (uint32_t)m_index.size();
+	unsigned int encodedSize = 0;
+
+	if (m_compress && frameIndex > 0 && frameIndex - m_lastKeyframe < m_header.keyframeInterval)
+	{
+		encodedSize = encodeFrameDelta(m_previousFrame.data(), frame.getPixelBuffer(), m_frameSize, m_encodeBuffer);
+	}
+
+	SessionFrameInfo info;
+	info.sequence = packet.sequence;
+	info.timestamp = std::chrono::duration_cast<std::chrono::microseconds>(packet.timestamp.time_since_epoch()).count();
+	info.reserved = 0;
+
+	if (encodedSize > 0)
+	{
+		info.encoding = (uint32_t)FrameEncoding::XOR_RLE;
+		writeChunkHeader(SESSION_CHUNK_FRAME, sizeof(info) + encodedSize);
+		m_file.write((const char*)&info, sizeof(info));
+		m_file.write((const char*)m_encodeBuffer.data(), encodedSize);
+	}
+	else
+	{
+		info.encoding = (uint32_t)FrameEncoding::RAW;
+		writeChunkHeader(SESSION_CHUNK_FRAME, sizeof(info) + m_frameSize);
+		m_file.write((const char*)&info, sizeof(info));
+		m_file.write((const char*)frame.getPixelBuffer(), m_frameSize);
+		m_lastKeyframe = frameIndex;
+	}
+
+	entry.keyframe = m_lastKeyframe;
+	memcpy(m_previousFrame.data(), frame.getPixelBuffer(), m_frameSize);
+
+	// MARKERS
+	const std::vector<MarkerResult>& results = packet.tracking.markers;
+	std::vector<SessionMarkerRecord> markers(results.size());
+	for (int i = 0; i < results.size(); i++)
+	{
+		markers[i].markerID = results[i].markerID;
+		markers[i].error = results[i].error;
+		memcpy(markers[i].pose, glm::value_ptr(results[i].pose), sizeof(markers[i].pose));
+		memcpy(markers[i].offsetPose, glm::value_ptr(results[i].offsetPose), sizeof(markers[i].offsetPose));
+	}
+	writeChunk(SESSION_CHUNK_MARKERS, markers.data(), (uint32_t)(markers.size() * sizeof(SessionMarkerRecord)));
+
+	// POSES
+	double poses[32];
+	memcpy(poses, glm::value_ptr(packet.worldPose), 16 * sizeof(double));
+	memcpy(poses + 16, glm::value_ptr(packet.dodecahedronPose), 16 * sizeof(double));
+	writeChunk(SESSION_CHUNK_POSES, poses, sizeof(poses));
+
+	// FACES
+	std::vector<SessionFaceRecord> faces(packet.faces.size());
+	for (int i = 0; i < packet.faces.size(); i++)
+	{
+		faces[i].markerID = packet.faces[i].markerID;
+		faces[i].luminance = packet.faces[i].luminance;
+		memcpy(faces[i].normal, glm::value_ptr(packet.faces[i].normal), sizeof(faces[i].normal));
+	}
+	writeChunk(SESSION_CHUNK_FACES, faces.data(), (uint32_t)(faces.size() * sizeof(SessionFaceRecord)));
+
+	// LIGHT
+	SessionLightRecord light;
+	light.estimated = packet.lightEstimated ? 1 : 0;
+	memcpy(light.direction, glm::value_ptr(packet.lightDirection), sizeof(light.direction));
+	light.intensity = packet.lightIntensity;
+	light.ambient = packet.ambientIntensity;
+	writeChunk(SESSION_CHUNK_LIGHT, &light, sizeof(light));
+
+	m_index.push_back(entry);
+	return m_file.good();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void SessionRecorder::writeChunk(uint32_t type, const void* p_payload, uint32_t size)
+{
+	writeChunkHeader(type, size);
+	if (size > 0)
+	{
+		m_file.write((const char*)p_payload, size);
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void SessionRecorder::writeChunkHeader(uint32_t type, uint32_t size)
+{
+	SessionChunkHeader header;
+	header.type = type;
+	header.size = size;
+	m_file.write((const char*)&header, sizeof(header));
+}
+
+
+//================================================================================//
+
+
+SessionReader::SessionReader()
+{
+	mp_data = NULL;
+	mp_index = NULL;
+	m_size = 0;
+	memset(&m_header, 0, sizeof(m_header));
+
+#ifdef _WIN32
+	m_fileHandle = INVALID_HANDLE_VALUE;
+	m_mappingHandle = NULL;
+#else
+	m_fileDescriptor = -1;
+#endif
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+SessionReader::~SessionReader()
+{
+	close();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool SessionReader::open(const std::string &path)
+{
+	close();
+
+	// MAP THE FILE
+#ifdef _WIN32
+	m_fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (m_fileHandle == INVALID_HANDLE_VALUE)
+	{
+		std::cout << "SESSION READER: Couldn't open \"" << path << "\"." << std::endl;
+		return false;
+	}
+
+	LARGE_INTEGER fileSize;
+	GetFileSizeEx(m_fileHandle, &fileSize);
+	m_size = (uint64_t)fileSize.QuadPart;
+
+	if (m_size >= sizeof(SessionHeader))
+	{
+		m_mappingHandle = CreateFileMappingA(m_fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (m_mappingHandle != NULL)
+		{
+			mp_data = (const ubyte*)MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0);
+		}
+	}
+#else
+	m_fileDescriptor = ::open(path.c_str(), O_RDONLY);
+	if (m_fileDescriptor < 0)
+	{
+		std::cout << "SESSION READER: Couldn't open \"" << path << "\"." << std::endl;
+		return false;
+	}
+
+	struct stat fileStatus;
+	fstat(m_fileDescriptor, &fileStatus);
+	m_size = (uint64_t)fileStatus.st_size;
+
+	if (m_size >= sizeof(SessionHeader))
+	{
+		void* p_map = mmap(NULL, m_size, PROT_READ, MAP_SHARED, m_fileDescriptor, 0);
+		if (p_map != MAP_FAILED)
+		{
+			mp_data = (const ubyte*)p_map;
+			madvise(p_map, m_size, MADV_SEQUENTIAL);
+		}
+	}
+#endif
+
+	if (mp_data == NULL)
+	{
+		std::cout << "SESSION READER: Couldn't map \"" << path << "\"." << std::endl;
+		close();
+		return false;
+	}
+
+	// VALIDATE HEADER AND INDEX
+	memcpy(&m_header, mp_data, sizeof(m_header));
+
+	if (memcmp(m_header.magic, SESSION_MAGIC, sizeof(SESSION_MAGIC)) != 0 || m_header.version != SESSION_VERSION)
+	{
+		std::cout << "SESSION READER: \"" << path << "\" is not a session recording." << std::endl;
+		close();
+		return false;
+	}
+
+	if (m_header.indexOffset == 0 || m_header.indexOffset + sizeof(SessionChunkHeader) > m_size)
+	{
+		std::cout << "SESSION READER: \"" << path << "\" was not closed properly and has no index." << std::endl;
+		close();
+		return false;
+	}
+
+	SessionChunkHeader chunk;
+	memcpy(&chunk, mp_data + m_header.indexOffset, sizeof(chunk));
+	if (chunk.type != SESSION_CHUNK_INDEX
+		|| chunk.size != m_header.frameCount * sizeof(SessionIndexEntry)
+		|| m_header.indexOffset + sizeof(chunk) + chunk.size > m_size)
+	{
+		std::cout << "SESSION READER: \"" << path << "\" has a corrupt index." << std::endl;
+		close();
+		return false;
+	}
+
+	mp_index = (const SessionIndexEntry*)(mp_data + m_header.indexOffset + sizeof(chunk));
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void SessionReader::close()
+{
+#ifdef _WIN32
+	if (mp_data != NULL)
+	{
+		UnmapViewOfFile(mp_data);
+	}
+	if (m_mappingHandle != NULL)
+	{
+		CloseHandle(m_mappingHandle);
+		m_mappingHandle = NULL;
+	}
+	if (m_fileHandle != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(m_fileHandle);
+		m_fileHandle = INVALID_HANDLE_VALUE;
+	}
+#else
+	if (mp_data != NULL)
+	{
+		munmap((void*)mp_data, m_size);
+	}
+	if (m_fileDescriptor >= 0)
+	{
+		::close(m_fileDescriptor);
+		m_fileDescriptor = -1;
+	}
+#endif
+
+	mp_data = NULL;
+	mp_index = NULL;
+	m_size = 0;
+	memset(&m_header, 0, sizeof(m_header));
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool SessionReader::decodeFrame(int index, ubyte* p_frame, int decodedIndex) const
+{
+	if (!isOpen() || index < 0 || index >= getFrameCount())
+	{
+		return false;
+	}
+
+	int first = mp_index[index].keyframe;
+	if (decodedIndex >= first && decodedIndex <= index)
+	{
+		first = decodedIndex + 1; // p_frame already holds everything up to decodedIndex.
+	}
+
+	for (int i = first; i <= index; i++)
+	{
+		if (!applyFrame(i, p_frame))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool SessionReader::applyFrame(int index, ubyte* p_frame) const
+{
+	uint32_t size;
+	const ubyte* p_chunk = findChunk(index, SESSION_CHUNK_FRAME, size);
+	if (p_chunk == NULL || size < sizeof(SessionFrameInfo))
+	{
+		return false;
+	}
+
+	SessionFrameInfo info;
+	memcpy(&info, p_chunk, sizeof(info));
+	p_chunk += sizeof(info);
+	size -= sizeof(info);
+
+	switch ((FrameEncoding)info.encoding)
+	{
+	case FrameEncoding::RAW:
+		if (size != getFrameSize())
+		{
+			return false;
+		}
+		memcpy(p_frame, p_chunk, size);
+		return true;
+
+	case FrameEncoding::XOR_RLE:
+		return decodeFrameDelta(p_chunk, size, p_frame, getFrameSize());
+	}
+
+	return false;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool SessionReader::readResults(int index, FramePacket &packet, ReplayLevel level) const
+{
+	if (!isOpen() || index < 0 || index >= getFrameCount())
+	{
+		return false;
+	}
+
+	if (level == ReplayLevel::NONE)
+	{
+		return true;
+	}
+
+	uint32_t size;
+	const ubyte* p_chunk;
+
+	// MARKERS
+	if ((p_chunk = findChunk(index, SESSION_CHUNK_MARKERS, size)) == NULL)
+	{
+		return false;
+	}
+	SessionMarkerRecord record;
+	std::vector<MarkerResult>& results = packet.tracking.markers;
+	results.resize(size / sizeof(SessionMarkerRecord));
+	for (int i = 0; i < results.size(); i++, p_chunk += sizeof(record))
+	{
+		memcpy(&record, p_chunk, sizeof(record));
+		results[i].markerID = record.markerID;
+		results[i].error = record.error;
+		results[i].state = (record.error != -1) ? MarkerState::TRACKING : MarkerState::UNREGISTERED; // Not recorded
+		results[i].pose = glm::make_mat4x4(record.pose);
+		results[i].offsetPose = glm::make_mat4x4(record.offsetPose);
+		results[i].visible = true; // Not recorded
+		results[i].visibilityKnown = false;
+	}
+	packet.tracking.frameSequence = packet.frameSequence;
+	packet.tracking.buildIndex();
+
+	// POSES
+	if ((p_chunk = findChunk(index, SESSION_CHUNK_POSES, size)) == NULL || size != 32 * sizeof(double))
+	{
+		return false;
+	}
+	double poses[32];
+	memcpy(poses, p_chunk, sizeof(poses));
+	packet.worldPose = glm::make_mat4x4(poses);
+	packet.dodecahedronPose = glm::make_mat4x4(poses + 16);
+
+	if (level != ReplayLevel::SAMPLING)
+	{
+		return true;
+	}
+
+	// FACES
+	if ((p_chunk = findChunk(index, SESSION_CHUNK_FACES, size)) == NULL)
+	{
+		return false;
+	}
+	SessionFaceRecord face;
+	packet.faces.resize(size / sizeof(SessionFaceRecord));
+	for (int i = 0; i < packet.faces.size(); i++, p_chunk += sizeof(face))
+	{
+		memcpy(&face, p_chunk, sizeof(face));
+		packet.faces[i].markerID = face.markerID;
+		packet.faces[i].luminance = face.luminance;
+		packet.faces[i].normal = glm::make_vec4(face.normal);
+	}
+	packet.facesReplayed = true;
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool SessionReader::readLight(int index, SessionLightRecord &light) const
+{
+	uint32_t size;
+	const ubyte* p_chunk = findChunk(index, SESSION_CHUNK_LIGHT, size);
+
+	if (p_chunk == NULL || size != sizeof(light))
+	{
+		return false;
+	}
+
+	memcpy(&light, p_chunk, sizeof(light));
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+const ubyte* SessionReader::findChunk(int index, uint32_t type, uint32_t &size) const
+{
+	if (!isOpen() || index < 0 || index >= getFrameCount())
+	{
+		return NULL;
+	}
+
+	uint64_t offset = mp_index[index].offset;
+	uint64_t end = offset + mp_index[index].size;
+	if (end > m_header.indexOffset)
+	{
+		return NULL;
+	}
+
+	SessionChunkHeader chunk;
+	while (offset + sizeof(chunk) <= end)
+	{
+		memcpy(&chunk, mp_data + offset, sizeof(chunk));
+		offset += sizeof(chunk);
+
+		if (offset + chunk.size > end)
+		{
+			return NULL; // Truncated chunk
+		}
+
+		if (chunk.type == type)
+		{
+			size = chunk.size;
+			return mp_data + offset;
+		}
+
+		offset += chunk.size;
+	}
+
+	return NULL;
+}
+
+
+//================================================================================//
+
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Delta stream: repeated pairs of
+//		varint skip		Number of unchanged bytes
+//		varint count	Number of changed bytes, followed by their XOR
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+static void writeVarint(std::vector<ubyte> &out, uint32_t value)
+{
+	while (value >= 0x80)
+	{
+		out.push_back((ubyte)(value | 0x80));
+		value >>= 7;
+	}
+	out.push_back((ubyte)value);
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+static bool readVarint(const ubyte* &p_in, const ubyte* p_end, uint32_t &value)
+{
+	value = 0;
+	for (int shift = 0; shift < 35 && p_in < p_end; shift += 7)
+	{
+		ubyte b = *p_in++;
+		value |= (uint32_t)(b & 0x7F) << shift;
+		if ((b & 0x80) == 0)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+unsigned int encodeFrameDelta(const ubyte* p_previous, const ubyte* p_current, unsigned int size, std::vector<ubyte> &encoded)
+{
+	// A changed byte is only worth a new run once this many unchanged bytes separate it from the last one.
+	const unsigned int MIN_SKIP = 4;
+
+	encoded.clear();
+	encoded.reserve(size / 4);
+
+	unsigned int i = 0;
+	while (i < size)
+	{
+		// UNCHANGED RUN, eight bytes at a time where possible.
+		unsigned int start = i;
+		uint64_t a, b;
+		while (i + 8 <= size)
+		{
+			memcpy(&a, p_previous + i, 8);
+			memcpy(&b, p_current + i, 8);
+			if (a != b)
+			{
+				break;
+			}
+			i += 8;
+		}
+		while (i < size && p_previous[i] == p_current[i])
+		{
+			i++;
+		}
+		unsigned int skip = i - start;
+
+		// CHANGED RUN, absorbing unchanged gaps too short to pay for a new pair.
+		start = i;
+		unsigned int gap = 0;
+		while (i < size && gap < MIN_SKIP)
+		{
+			gap = (p_previous[i] == p_current[i]) ? gap + 1 : 0;
+			i++;
+		}
+		i -= gap;
+		unsigned int count = i - start;
+
+		writeVarint(encoded, skip);
+		writeVarint(encoded, count);
+		for (unsigned int j = start; j < i; j++)
+		{
+			encoded.push_back(p_previous[j] ^ p_current[j]);
+		}
+
+		if (encoded.size() >= size)
+		{
+			return 0; // Not worth it; store the frame raw.
+		}
+	}
+
+	return (unsigned int)encoded.size();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool decodeFrameDelta(const ubyte* p_encoded, unsigned int encodedSize, ubyte* p_frame, unsigned int size)
+{
+	const ubyte* p_in = p_encoded;
+	const ubyte* p_end = p_encoded + encodedSize;
+	uint64_t position = 0;
+	uint32_t skip, count;
+
+	while (p_in < p_end)
+	{
+		if (!readVarint(p_in, p_end, skip) || !readVarint(p_in, p_end, count))
+		{
+			return false;
+		}
+
+		position += skip;
+		if (position + count > size || (uint64_t)(p_end - p_in) < count)
+		{
+			return false;
+		}
+
+		for (uint32_t j = 0; j < count; j++)
+		{
+			p_frame[position + j] ^= p_in[j];
+		}
+
+		p_in += count;
+		position += count;
+	}
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+ReplayLevel parseReplayLevel(const std::string& text)
+{
+	std::string workingString = toLower(text);
+
+	if (workingString == "none") return ReplayLevel::NONE;
+	else if (workingString == "detection") return ReplayLevel::DETECTION;
+	else if (workingString == "sampling") return ReplayLevel::SAMPLING;
+
+	return ReplayLevel::INVALID; // If no correct level is detected
+}
\ No newline at end of file
@@ -0,0 +1,266 @@
+//================================================================================//
+// SessionRecording
+//	- Binary recording and replay of everything the tracker saw and produced.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//--------------------------------------------------------------------------------//
+// NOTE: Layout of a session file (all values little-endian):
+//			SessionHeader
+//			Frame 0: FRAM chunk, followed by MRKR, POSE, FACE and LGHT chunks
+//			Frame 1: ...
+//			INDX chunk: one SessionIndexEntry per frame
+//		 Every chunk starts with a SessionChunkHeader, so readers can skip chunk
+//		 types they do not know. The header is rewritten on close() with the
+//		 frame count and the offset of the index, which makes seeking O(1).
+//		 Frames are stored either raw (keyframes) or as the XOR against the
+//		 previous frame with runs of unchanged bytes collapsed. A keyframe is
+//		 forced every keyframe interval so a seek never decodes more than that
+//		 many deltas.
+//================================================================================//
+#pragma once
+
+#include<AR/ar.h>
+#include<string>
+#include<vector>
+#include<fstream>
+#include<cstdint>
+
+#include "TypeDef.hpp"
+#include "FramePipeline.hpp"
+
+
+// ENUMERATIONS
+enum class FrameEncoding
+{
+	RAW = 0,		// Keyframe; pixels stored as-is.
+	XOR_RLE = 1		// Delta against the previous frame.
+};
+
+// How much of a recorded frame replaces live processing.
+enum class ReplayLevel
+{
+	NONE,			// Only the pixels are replayed; everything is recomputed.
+	DETECTION,		// Marker results are replayed; sampling and estimation are re-run.
+	SAMPLING,		// Face luminance is replayed as well; only estimation is re-run.
+	INVALID = -1	// Used as a default value for the function parseReplayLevel
+};
+
+
+//--------------------------------------------------------------------------------//
+// FILE STRUCTURES
+//--------------------------------------------------------------------------------//
+
+// CHUNK TYPES (four ASCII characters read as a little-endian integer)
+static const uint32_t SESSION_CHUNK_FRAME = 0x4D415246;		// "FRAM": SessionFrameInfo, then pixels
+static const uint32_t SESSION_CHUNK_MARKERS = 0x524B524D;	// "MRKR": SessionMarkerRecord array
+static const uint32_t SESSION_CHUNK_POSES = 0x45534F50;		// "POSE": world and dodecahedron poses
+static const uint32_t SESSION_CHUNK_FACES = 0x45434146;		// "FACE": SessionFaceRecord array
+static const uint32_t SESSION_CHUNK_LIGHT = 0x5448474C;		// "LGHT": SessionLightRecord
+static const uint32_t SESSION_CHUNK_INDEX = 0x58444E49;		// "INDX": SessionIndexEntry array
+
+struct SessionHeader
+{
+	char magic[4];				// "ARSS"
+	uint32_t version;
+	int32_t width;
+	int32_t height;
+	int32_t pixelFormat;		// AR_PIXEL_FORMAT
+	uint32_t bytesPerPixel;
+	uint32_t keyframeInterval;
+	uint32_t frameCount;		// Written by close()
+	uint64_t indexOffset;		// Written by close(); 0 if the recording was never closed.
+	uint8_t reserved[24];
+};
+
+struct SessionChunkHeader
+{
+	uint32_t type;				// One of the SESSION_CHUNK_* codes
+	uint32_t size;				// Payload size in bytes, not counting this header.
+};
+
+struct SessionFrameInfo
+{
+	uint64_t sequence;
+	int64_t timestamp;			// Microseconds on the steady clock
+	uint32_t encoding;			// FrameEncoding
+	uint32_t reserved;
+};
+
+struct SessionMarkerRecord
+{
+	int32_t markerID;
+	float error;
+	double pose[16];
+	double offsetPose[16];
+};
+
+struct SessionFaceRecord
+{
+	int32_t markerID;
+	float luminance;
+	float normal[4];
+};
+
+struct SessionLightRecord
+{
+	uint32_t estimated;
+	float direction[3];
+	float intensity;
+	float ambient;
+};
+
+struct SessionIndexEntry
+{
+	uint64_t offset;			// File offset of the frame's FRAM chunk
+	uint32_t keyframe;			// Index of the keyframe this frame is decoded from.
+	uint32_t size;				// Bytes from offset to the start of the next frame.
+};
+
+
+//--------------------------------------------------------------------------------//
+
+
+class SessionRecorder
+{
+public:
+	SessionRecorder();
+	~SessionRecorder();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Creates the session file and writes a provisional header.
+	// INPUT:
+	//	* keyframeInterval: Largest number of frames between raw frames.
+	//	* compress: When false every frame is stored raw.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool open(const std::string &path, int width, int height, AR_PIXEL_FORMAT pixelFormat,
+		unsigned int keyframeInterval = 30, bool compress = true);
+
+	// Writes the index and the final header. Called by the destructor.
+	void close();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Appends one frame with its pixels and every result
+	//				stored in the packet.
+	// MUTATES:
+	//	- m_index, m_previousFrame
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool writeFrame(const FramePacket &packet);
+
+	inline bool isOpen() const { return m_file.is_open(); }
+	inline unsigned int getFrameCount() const { return (unsigned int)m_index.size(); }
+
+private:
+	std::ofstream m_file;
+	SessionHeader m_header;
+	bool m_compress;
+	unsigned int m_frameSize;
+	uint32_t m_lastKeyframe;
+
+	std::vector<SessionIndexEntry> m_index;
+	std::vector<ubyte> m_previousFrame;
+	std::vector<ubyte> m_encodeBuffer;
+
+	void writeChunk(uint32_t type, const void* p_payload, uint32_t size);
+	void writeChunkHeader(uint32_t type, uint32_t size);
+};
+
+
+//--------------------------------------------------------------------------------//
+
+
+class SessionReader
+{
+public:
+	SessionReader();
+	~SessionReader();
+
+	// Memory-maps the session and validates its header and index.
+	bool open(const std::string &path);
+	void close();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Decodes the pixels of a frame.
+	// OUTPUT: False if the index is out of range or the data is corrupt.
+	// INPUT:
+	//	* p_frame: Buffer of getFrameSize() bytes.
+	//	* decodedIndex: Frame that p_frame already holds, or -1. When it
+	//	  lies between the frame's keyframe and the frame, decoding
+	//	  continues from it instead of starting over at the keyframe.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool decodeFrame(int index, ubyte* p_frame, int decodedIndex = -1) const;
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Fills a packet with the results recorded for a frame.
+	// OUTPUT: False if the index is out of range or the data is corrupt.
+	// NOTES: Only the parts selected by level are touched. The packet's
+	//		  image, sequence and timestamp are never modified.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool readResults(int index, FramePacket &packet, ReplayLevel level) const;
+
+	// Light estimate that was recorded for a frame, for comparison against a re-run.
+	bool readLight(int index, SessionLightRecord &light) const;
+
+	// GETTERS
+	inline bool isOpen() const { return mp_data != NULL; }
+	inline int getFrameCount() const { return (int)m_header.frameCount; }
+	inline int getWidth() const { return m_header.width; }
+	inline int getHeight() const { return m_header.height; }
+	inline AR_PIXEL_FORMAT getPixelFormat() const { return (AR_PIXEL_FORMAT)m_header.pixelFormat; }
+	inline unsigned int getFrameSize() const { return m_header.width * m_header.height * m_header.bytesPerPixel; }
+
+private:
+	const ubyte* mp_data;		// Mapped file
+	uint64_t m_size;
+	SessionHeader m_header;
+	const SessionIndexEntry* mp_index;
+
+#ifdef _WIN32
+	void* m_fileHandle;
+	void* m_mappingHandle;
+#else
+	int m_fileDescriptor;
+#endif
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Finds a chunk of the provided type within a frame.
+	// OUTPUT: Pointer to the chunk's payload, or NULL.
+	// INPUT:
+	//	* size: Receives the payload size.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	const ubyte* findChunk(int index, uint32_t type, uint32_t &size) const;
+
+	// Applies a single frame's pixel chunk to p_frame.
+	bool applyFrame(int index, ubyte* p_frame) const;
+};
+
+
+//================================================================================//
+
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Encodes current as the XOR against previous, with runs of
+//				zero bytes collapsed.
+// OUTPUT: Encoded size, or 0 if the encoding would not be smaller than
+//		   size bytes (the frame should be stored raw instead).
+// ARGUMENTS:
+//	- p_previous, p_current: Frames of size bytes each.
+//	- encoded: Receives the encoded bytes.
+//---------------------------------------------------------------------------//
+unsigned int encodeFrameDelta(const ubyte* p_previous, const ubyte* p_current, unsigned int size, std::vector<ubyte> &encoded);
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Applies a delta produced by encodeFrameDelta in place.
+// OUTPUT: False if the delta runs past the end of the frame.
+// ARGUMENTS:
+//	- p_frame: Holds the previous frame on input, the new one on output.
+//---------------------------------------------------------------------------//
+bool decodeFrameDelta(const ubyte* p_encoded, unsigned int encodedSize, ubyte* p_frame, unsigned int size);
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Utility function to help parse replay levels from file contents.
+// OUTPUT: Matching ReplayLevel, or ReplayLevel::INVALID.
+// ARGUMENTS:
+//	- text: String to be interpreted as a replay level (e.g. "detection").
+//---------------------------------------------------------------------------//
+ReplayLevel parseReplayLevel(const std::string& text);
\ No newline at end of file
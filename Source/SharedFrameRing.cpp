@@ -0,0 +1,422 @@
+//================================================================================//
+// SharedFrameRing
+//	- Ring of camera frames in named shared memory, written by one producer
+//	  process and read in place by any number of consumer processes.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//================================================================================//
+#include "SharedFrameRing.hpp"
+
+#include <cstring>
+#include <chrono>
+#include <thread>
+#include <climits>
+#include <iostream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#endif
+
+
+static const uint64_t SHARED_FRAME_ALIGNMENT = 4096;
+
+
+SharedFrameRing::SharedFrameRing()
+{
+	mp_header = NULL;
+	m_size = 0;
+	m_producer = false;
+	m_sequence = 0;
+	m_writeSlot = -1;
+	m_heldSlot = -1;
+
+#ifdef _WIN32
+	m_mappingHandle = NULL;
+#else
+	m_fileDescriptor = -1;
+#endif
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+SharedFrameRing::~SharedFrameRing()
+{
+	close();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool SharedFrameRing::create(const std::string &name, int width, int height, int pixelFormat, int bytesPerPixel, unsigned int slotCount)
+{
+	close();
+
+	if (width <= 0 || height <= 0 || bytesPerPixel <= 0 || slotCount < 3 || slotCount > SHARED_FRAME_MAX_SLOTS)
+	{
+		return false;
+	}
+
+	uint64_t frameSize = (uint64_t)width * height * bytesPerPixel;
+	uint64_t dataOffset = (sizeof(SharedFrameHeader) + SHARED_FRAME_ALIGNMENT - 1) / SHARED_FRAME_ALIGNMENT * SHARED_FRAME_ALIGNMENT;
+	uint64_t slotStride = (frameSize + SHARED_FRAME_ALIGNMENT - 1) / SHARED_FRAME_ALIGNMENT * SHARED_FRAME_ALIGNMENT;
+
+	m_name = name;
+	m_size = dataOffset + slotStride * slotCount;
+	m_producer = true;
+	if (!map(true))
+	{
+		return false;
+	}
+
+	// Consumers ignore the ring until the magic is written.
+	memset(mp_header->magic, 0, sizeof(mp_header->magic));
+	mp_header->version = SHARED_FRAME_VERSION;
+	mp_header->width = width;
+	mp_header->height = height;
+	mp_header->pixelFormat = pixelFormat;
+	mp_header->bytesPerPixel = bytesPerPixel;
+	mp_header->slotCount = slotCount;
+	mp_header->reserved0 = 0;
+	mp_header->frameSize = frameSize;
+	mp_header->dataOffset = dataOffset;
+	mp_header->slotStride = slotStride;
+	mp_header->latestSequence.store(0, std::memory_order_relaxed);
+	mp_header->latestSlot.store(0, std::memory_order_relaxed);
+	mp_header->wakeup.store(0, std::memory_order_relaxed);
+	memset(mp_header->reserved, 0, sizeof(mp_header->reserved));
+	for (unsigned int i = 0; i < SHARED_FRAME_MAX_SLOTS; i++)
+	{
+		SharedFrameSlot &slot = mp_header->slots[i];
+		slot.sequence.store(0, std::memory_order_relaxed);
+		slot.readers.store(0, std::memory_order_relaxed);
+		slot.reserved0 = 0;
+		slot.timestamp = 0;
+		memset(slot.reserved, 0, sizeof(slot.reserved));
+	}
+	std::atomic_thread_fence(std::memory_order_release);
+	memcpy(mp_header->magic, SHARED_FRAME_MAGIC, sizeof(SHARED_FRAME_MAGIC));
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool SharedFrameRing::attach(const std::string &name)
+{
+	close();
+
+	m_name = name;
+	m_producer = false;
+	if (!map(false))
+	{
+		return false;
+	}
+
+	std::atomic_thread_fence(std::memory_order_acquire);
+	if (memcmp(mp_header->magic, SHARED_FRAME_MAGIC, sizeof(SHARED_FRAME_MAGIC)) != 0 || mp_header->version != SHARED_FRAME_VERSION
+		|| mp_header->slotCount > SHARED_FRAME_MAX_SLOTS || m_size < mp_header->dataOffset + mp_header->slotStride * mp_header->slotCount)
+	{
+		std::cout << "SHARED FRAME RING: \"" << name << "\" is not a frame ring, or its producer is still starting." << std::endl;
+		close();
+		return false;
+	}
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void SharedFrameRing::close()
+{
+	if (mp_header != NULL)
+	{
+		release();
+
+#ifdef _WIN32
+		UnmapViewOfFile(mp_header);
+#else
+		munmap(mp_header, m_size);
+#endif
+		mp_header = NULL;
+	}
+
+#ifdef _WIN32
+	if (m_mappingHandle != NULL)
+	{
+		CloseHandle(m_mappingHandle);
+		m_mappingHandle = NULL;
+	}
+#else
+	if (m_fileDescriptor >= 0)
+	{
+		::close(m_fileDescriptor);
+		m_fileDescriptor = -1;
+
+		if (m_producer)
+		{
+			shm_unlink(m_name.c_str());
+		}
+	}
+#endif
+
+	m_size = 0;
+	m_sequence = 0;
+	m_writeSlot = -1;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool SharedFrameRing::map(bool create)
+{
+#ifdef _WIN32
+	if (create)
+	{
+		m_mappingHandle = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, (DWORD)(m_size >> 32), (DWORD)m_size, m_name.c_str());
+	}
+	else
+	{
+		m_mappingHandle = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, m_name.c_str());
+	}
+
+	if (m_mappingHandle != NULL)
+	{
+		mp_header = (SharedFrameHeader*)MapViewOfFile(m_mappingHandle, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+	}
+
+	if (mp_header != NULL && !create)
+	{
+		MEMORY_BASIC_INFORMATION info;
+		VirtualQuery(mp_header, &info, sizeof(info));
+		m_size = info.RegionSize;
+	}
+#else
+	if (!m_name.empty() && m_name[0] != '/')
+	{
+		m_name = "/" + m_name;
+	}
+
+	if (create)
+	{
+		shm_unlink(m_name.c_str()); // A ring left by a crashed producer.
+		m_fileDescriptor = shm_open(m_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0666);
+		if (m_fileDescriptor >= 0 && ftruncate(m_fileDescriptor, (off_t)m_size) < 0)
+		{
+			::close(m_fileDescriptor);
+			shm_unlink(m_name.c_str());
+			m_fileDescriptor = -1;
+		}
+	}
+	else
+	{
+		// Read-write: consumers register in the slots' reader counts.
+		m_fileDescriptor = shm_open(m_name.c_str(), O_RDWR, 0);
+
+		struct stat fileStatus;
+		if (m_fileDescriptor >= 0 && fstat(m_fileDescriptor, &fileStatus) == 0)
+		{
+			m_size = (uint64_t)fileStatus.st_size;
+		}
+	}
+
+	if (m_fileDescriptor >= 0 && m_size >= sizeof(SharedFrameHeader))
+	{
+		void* p_map = mmap(NULL, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fileDescriptor, 0);
+		if (p_map != MAP_FAILED)
+		{
+			mp_header = (SharedFrameHeader*)p_map;
+		}
+	}
+#endif
+
+	if (mp_header == NULL)
+	{
+		std::cout << "SHARED FRAME RING: Couldn't " << (create ? "create" : "open") << " \"" << m_name << "\"." << std::endl;
+		close();
+		return false;
+	}
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+ubyte* SharedFrameRing::beginWrite()
+{
+	if (mp_header == NULL || !m_producer)
+	{
+		return NULL;
+	}
+
+	uint32_t latest = mp_header->latestSlot.load(std::memory_order_relaxed);
+	int start = (m_writeSlot < 0) ? 0 : m_writeSlot;
+
+	for (unsigned int i = 1; i <= mp_header->slotCount; i++)
+	{
+		unsigned int slot = (start + i) % mp_header->slotCount;
+		SharedFrameSlot &candidate = mp_header->slots[slot];
+
+		if (m_sequence > 0 && slot == latest)
+		{
+			continue; // Newest frame; consumers may be about to take it.
+		}
+
+		// Mark first, then look for readers; a consumer registers first, then looks at the mark.
+		uint64_t previous = candidate.sequence.exchange(SHARED_FRAME_WRITING);
+		if (candidate.readers.load() == 0)
+		{
+			m_writeSlot = slot;
+			return getSlotPixels(slot);
+		}
+		candidate.sequence.store(previous);
+	}
+
+	return NULL;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void SharedFrameRing::publish(uint64_t timestamp)
+{
+	if (mp_header == NULL || m_writeSlot < 0)
+	{
+		return;
+	}
+
+	SharedFrameSlot &slot = mp_header->slots[m_writeSlot];
+	slot.timestamp = timestamp;
+	slot.sequence.store(++m_sequence, std::memory_order_release);
+
+	mp_header->latestSlot.store(m_writeSlot, std::memory_order_release);
+	mp_header->latestSequence.store(m_sequence, std::memory_order_release);
+	mp_header->wakeup.fetch_add(1, std::memory_order_release);
+
+#ifdef __linux__
+	syscall(SYS_futex, &mp_header->wakeup, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+#endif
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+const ubyte* SharedFrameRing::acquireLatest(uint64_t lastSequence, uint64_t &sequence, uint64_t &timestamp)
+{
+	if (mp_header == NULL)
+	{
+		return NULL;
+	}
+
+	// A few retries cover the producer claiming the slot between the two loads.
+	for (int attempt = 0; attempt < 4; attempt++)
+	{
+		uint64_t latest = mp_header->latestSequence.load(std::memory_order_acquire);
+		if (latest == 0 || latest <= lastSequence)
+		{
+			return NULL;
+		}
+
+		uint32_t slot = mp_header->latestSlot.load(std::memory_order_acquire);
+		if (slot >= mp_header->slotCount)
+		{
+			return NULL;
+		}
+
+		SharedFrameSlot &candidate = mp_header->slots[slot];
+		candidate.readers.fetch_add(1);
+
+		sequence = candidate.sequence.load();
+		if (sequence != SHARED_FRAME_WRITING && sequence > lastSequence)
+		{
+			release(); // The previous frame stays readable until the new one is held.
+			timestamp = candidate.timestamp;
+			m_heldSlot = slot;
+			return getSlotPixels(slot);
+		}
+
+		candidate.readers.fetch_sub(1);
+	}
+
+	return NULL;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void SharedFrameRing::release()
+{
+	if (mp_header != NULL && m_heldSlot >= 0)
+	{
+		mp_header->slots[m_heldSlot].readers.fetch_sub(1, std::memory_order_release);
+	}
+	m_heldSlot = -1;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool SharedFrameRing::waitForFrame(uint64_t lastSequence, unsigned int timeoutMilliseconds)
+{
+	if (mp_header == NULL)
+	{
+		return false;
+	}
+
+	uint32_t wakeup = mp_header->wakeup.load(std::memory_order_acquire);
+	if (mp_header->latestSequence.load(std::memory_order_acquire) > lastSequence)
+	{
+		return true;
+	}
+
+#ifdef __linux__
+	// Sleeps only while the word still holds the value read above, so a publish in between is not missed.
+	struct timespec timeout;
+	timeout.tv_sec = timeoutMilliseconds / 1000;
+	timeout.tv_nsec = (timeoutMilliseconds % 1000) * 1000000L;
+	syscall(SYS_futex, &mp_header->wakeup, FUTEX_WAIT, wakeup, &timeout, NULL, 0);
+#else
+	(void)wakeup;
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMilliseconds);
+	while (mp_header->latestSequence.load(std::memory_order_acquire) <= lastSequence && std::chrono::steady_clock::now() < end)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+#endif
+
+	return mp_header->latestSequence.load(std::memory_order_acquire) > lastSequence;
+}
+
+
+//================================================================================//
+
+
+uint64_t getSharedFrameTime()
+{
+	return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
\ No newline at end of file
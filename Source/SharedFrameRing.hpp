@@ -0,0 +1,156 @@
+//================================================================================//
+// SharedFrameRing
+//	- Ring of camera frames in named shared memory, written by one producer
+//	  process and read in place by any number of consumer processes.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//--------------------------------------------------------------------------------//
+// NOTE: Layout: a SharedFrameHeader, then slotCount page-aligned frames.
+//		 Each slot has a sequence number and a reader count. A consumer
+//		 registers as a reader before checking the slot's sequence. The
+//		 producer marks a slot as being written before checking its reader
+//		 count. Both use sequentially consistent operations, so a slot is
+//		 never rewritten while a consumer holds it. The slot that holds the
+//		 newest frame is never rewritten either.
+//		 Consumers wait on a futex in the header on Linux. Other platforms
+//		 poll. A consumer that dies while holding a slot leaves it pinned,
+//		 so rings should have at least two slots more than consumers.
+//================================================================================//
+#pragma once
+
+#include<atomic>
+#include<string>
+#include<cstdint>
+
+#include "TypeDef.hpp"
+
+
+static const char SHARED_FRAME_MAGIC[4] = { 'A', 'R', 'S', 'F' };
+static const uint32_t SHARED_FRAME_VERSION = 1;
+static const uint32_t SHARED_FRAME_MAX_SLOTS = 8;
+static const uint64_t SHARED_FRAME_WRITING = ~0ULL;	// Slot sequence while the producer writes it
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2, "Shared frame atomics must be lock-free to work across processes.");
+
+
+struct SharedFrameSlot
+{
+	std::atomic<uint64_t> sequence;	// Frame in the slot: 0 if empty, SHARED_FRAME_WRITING while written
+	std::atomic<uint32_t> readers;	// Consumers currently reading the slot
+	uint32_t reserved0;
+	uint64_t timestamp;				// Capture time, in microseconds of the steady clock
+	uint64_t reserved[5];			// Pads the slot to a cache line
+};
+
+
+struct SharedFrameHeader
+{
+	char magic[4];					// Written last by the producer, once the header is valid
+	uint32_t version;
+	int32_t width;
+	int32_t height;
+	int32_t pixelFormat;			// AR_PIXEL_FORMAT
+	int32_t bytesPerPixel;
+	uint32_t slotCount;
+	uint32_t reserved0;
+	uint64_t frameSize;				// Bytes of pixels per frame
+	uint64_t dataOffset;			// Offset of slot 0's pixels from the start of the header
+	uint64_t slotStride;			// Bytes between consecutive slots' pixels
+
+	std::atomic<uint64_t> latestSequence;	// Newest published frame; 0 before the first
+	std::atomic<uint32_t> latestSlot;		// Slot holding it
+	std::atomic<uint32_t> wakeup;			// Futex word; changes on every publish
+	uint64_t reserved[4];
+
+	SharedFrameSlot slots[SHARED_FRAME_MAX_SLOTS];
+};
+
+
+
+class SharedFrameRing
+{
+public:
+	SharedFrameRing();
+	~SharedFrameRing();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Creates the named ring as its producer, replacing any
+	//				ring a previous producer left behind.
+	// OUTPUT: False if the shared memory could not be created.
+	// INPUT:
+	//	* name: Shared memory name; a leading '/' is added on POSIX.
+	//	* slotCount: Number of frames in the ring [3, SHARED_FRAME_MAX_SLOTS].
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool create(const std::string &name, int width, int height, int pixelFormat, int bytesPerPixel, unsigned int slotCount = 4);
+
+	// Attaches to an existing ring as a consumer. False if it does not exist or is invalid.
+	bool attach(const std::string &name);
+
+	// Releases any held slot and unmaps the ring. The producer also removes the name.
+	void close();
+
+
+	// PRODUCER SIDE
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Claims a slot that no consumer is reading.
+	// OUTPUT: Pixels to fill, or NULL if every slot is busy (drop the
+	//		   frame).
+	// MUTATES:
+	//	- m_writeSlot
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	ubyte* beginWrite();
+
+	// Publishes the slot claimed by beginWrite() and wakes waiting consumers.
+	void publish(uint64_t timestamp);
+
+
+	// CONSUMER SIDE
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Takes the newest frame, if it is newer than
+	//				lastSequence, releasing the slot held before.
+	// OUTPUT: The frame's pixels, valid until a newer frame is acquired,
+	//		   release() or close(); NULL if there is no newer frame, in
+	//		   which case the held slot stays held.
+	// INPUT:
+	//	* sequence, timestamp: Receive the frame's sequence and capture time.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	const ubyte* acquireLatest(uint64_t lastSequence, uint64_t &sequence, uint64_t &timestamp);
+
+	// Lets the producer reuse the held slot.
+	void release();
+
+	// Blocks until a frame newer than lastSequence is published or the timeout passes.
+	bool waitForFrame(uint64_t lastSequence, unsigned int timeoutMilliseconds);
+
+	// GETTERS
+	inline bool isOpen() const { return mp_header != NULL; }
+	inline const SharedFrameHeader* getHeader() const { return mp_header; }
+
+private:
+	SharedFrameHeader* mp_header;
+	uint64_t m_size;
+	std::string m_name;
+	bool m_producer;
+	uint64_t m_sequence;		// Producer: last published sequence
+	int m_writeSlot;			// Producer: slot claimed by beginWrite(), or -1
+	int m_heldSlot;				// Consumer: slot being read, or -1
+
+#ifdef _WIN32
+	void* m_mappingHandle;
+#else
+	int m_fileDescriptor;
+#endif
+
+	bool map(bool create);
+	inline ubyte* getSlotPixels(unsigned int slot) { return (ubyte*)mp_header + mp_header->dataOffset + slot * mp_header->slotStride; }
+};
+
+
+//================================================================================//
+
+
+// Microseconds on the steady clock, the time base of slot timestamps.
+uint64_t getSharedFrameTime();
\ No newline at end of file
@@ -0,0 +1,117 @@
+//================================================================================//
+// ShmFrameSource
+//	- Frame source that reads frames published by another process through a
+//	  SharedFrameRing.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//================================================================================//
+#include "ShmFrameSource.hpp"
+
+#include <iostream>
+
+
+ShmFrameSource::ShmFrameSource(const std::string &name)
+{
+	m_name = name;
+	m_running = false;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+ShmFrameSource::~ShmFrameSource()
+{
+	close();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool ShmFrameSource::open()
+{
+	if (!m_ring.attach(m_name))
+	{
+		return false;
+	}
+
+	const SharedFrameHeader* p_header = m_ring.getHeader();
+	m_width = p_header->width;
+	m_height = p_header->height;
+	m_pixelFormat = (AR_PIXEL_FORMAT)p_header->pixelFormat;
+
+	if (arUtilGetPixelSize(m_pixelFormat) != p_header->bytesPerPixel)
+	{
+		std::cout << "SHM FRAME SOURCE: Pixel size of \"" << m_name << "\" does not match its pixel format." << std::endl;
+		m_ring.close();
+		return false;
+	}
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ShmFrameSource::close()
+{
+	stopCapture();
+	m_ring.close();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool ShmFrameSource::startCapture()
+{
+	m_running = m_ring.isOpen();
+	return m_running;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ShmFrameSource::stopCapture()
+{
+	m_running = false;
+	m_ring.release();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+ARUint8* ShmFrameSource::getImage()
+{
+	if (!m_running)
+	{
+		return NULL;
+	}
+
+	uint64_t sequence, timestamp;
+	const ubyte* p_pixels = m_ring.acquireLatest(m_frameSequence, sequence, timestamp);
+	if (p_pixels == NULL)
+	{
+		return NULL; // The previous frame stays held, so views of it remain intact.
+	}
+
+	// The producer's numbering and clock; the steady clock is shared between processes.
+	m_frameSequence = sequence;
+	m_frameTimestamp = std::chrono::steady_clock::time_point(std::chrono::microseconds(timestamp));
+
+	return (ARUint8*)p_pixels;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool ShmFrameSource::waitForFrame(unsigned int timeoutMilliseconds)
+{
+	return m_running && m_ring.waitForFrame(m_frameSequence, timeoutMilliseconds);
+}
\ No newline at end of file
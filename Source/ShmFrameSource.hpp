@@ -0,0 +1,44 @@
+//================================================================================//
+// ShmFrameSource
+//	- Frame source that reads frames published by another process through a
+//	  SharedFrameRing.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//--------------------------------------------------------------------------------//
+// NOTE: getImage() returns a pointer into the shared slot itself, so with zero
+//		 copy enabled frames cross the process boundary without being copied.
+//		 The slot stays reserved until a newer frame is returned or capture
+//		 stops.
+//		 Dimensions and pixel format come from the ring's header; the producer
+//		 must be running when the source is opened.
+//================================================================================//
+#pragma once
+
+#include<string>
+
+#include "FrameSource.hpp"
+#include "SharedFrameRing.hpp"
+
+class ShmFrameSource : public FrameSource
+{
+public:
+	ShmFrameSource(const std::string &name);
+	~ShmFrameSource();
+
+	bool open();
+	void close();
+
+	bool startCapture();
+	void stopCapture();
+
+	ARUint8* getImage();
+
+	// Sleeps on the ring's futex until the producer publishes.
+	bool waitForFrame(unsigned int timeoutMilliseconds);
+
+private:
+	std::string m_name;
+	SharedFrameRing m_ring;
+	bool m_running;
+};
\ No newline at end of file
@@ -0,0 +1,88 @@
+//================================================================================//
+// Telemetry
+//	- Process-wide event counters for measuring where frame time goes.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//================================================================================//
+#include "Telemetry.hpp"
+
+
+Telemetry::Telemetry()
+{
+	reset();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void Telemetry::report(std::ostream &out)
+{
+	out << "TELEMETRY (total / since last report):" << std::endl;
+
+	for (int i = 0; i < (int)TelemetryCounter::COUNT; i++)
+	{
+		unsigned long long total = m_counters[i].load(std::memory_order_relaxed);
+
+		out << "  " << getTelemetryCounterName((TelemetryCounter)i) << ": "
+			<< total << " / " << (total - m_reported[i]) << std::endl;
+		m_reported[i] = total;
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void Telemetry::reset()
+{
+	for (int i = 0; i < (int)TelemetryCounter::COUNT; i++)
+	{
+		m_counters[i] = 0;
+		m_reported[i] = 0;
+	}
+}
+
+
+//================================================================================//
+
+
+Telemetry& getTelemetry()
+{
+	static Telemetry telemetry;
+	return telemetry;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+const char* getTelemetryCounterName(TelemetryCounter counter)
+{
+	switch (counter)
+	{
+	case TelemetryCounter::FRAMES_CAPTURED:			return "Frames captured";
+	case TelemetryCounter::DUPLICATE_FRAMES:		return "Duplicate frames skipped";
+	case TelemetryCounter::FRAMES_PROCESSED:		return "Frames processed";
+	case TelemetryCounter::BACKDROP_UPLOADS:		return "Backdrop uploads";
+	case TelemetryCounter::BACKDROP_REUSES:			return "Backdrop reuses";
+	case TelemetryCounter::LIGHT_ESTIMATES:			return "Light estimates";
+	case TelemetryCounter::LIGHT_ESTIMATE_REUSES:	return "Light estimate reuses";
+	case TelemetryCounter::FRAME_ALLOCATIONS:		return "Frame allocations";
+	case TelemetryCounter::DETECTION_PASSES:		return "Detection passes";
+	case TelemetryCounter::SKIPPED_PASSES:			return "Detection passes skipped";
+	case TelemetryCounter::POSE_SOLVES:				return "Pose solves";
+	case TelemetryCounter::SEEDED_POSE_SOLVES:		return "Pose solves seeded from last frame";
+	case TelemetryCounter::SETTLED_POSE_SOLVES:		return "Pose solves capped as settled";
+	case TelemetryCounter::POSE_ITERATIONS:			return "Pose iterations";
+	case TelemetryCounter::POSE_RESIDUAL:			return "Pose residual (1/1000 px^2)";
+	case TelemetryCounter::MARKERS_DETECTED:		return "Markers detected";
+	case TelemetryCounter::MARKERS_CORNER_TRACKED:	return "Markers corner tracked";
+	case TelemetryCounter::CORNER_TRACKING_TIME:	return "Corner tracking time (us)";
+	case TelemetryCounter::PATTERN_COMPARISONS:		return "Pattern comparisons";
+	case TelemetryCounter::HINTED_IDENTIFICATIONS:	return "Hinted identifications";
+	case TelemetryCounter::HINT_FALLBACKS:			return "Hint fallbacks";
+	default:										return "Unknown";
+	}
+}
\ No newline at end of file
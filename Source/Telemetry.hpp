@@ -0,0 +1,87 @@
+//================================================================================//
+// Telemetry
+//	- Process-wide event counters for measuring where frame time goes.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//--------------------------------------------------------------------------------//
+// NOTE: Counters are relaxed atomics, so any thread (capture, detection,
+//		 analysis, render) may count without locking. Reports show the totals
+//		 and the change since the previous report.
+//================================================================================//
+#pragma once
+
+#include<atomic>
+#include<ostream>
+
+
+// ENUMERATIONS
+enum class TelemetryCounter
+{
+	FRAMES_CAPTURED,		// New frames delivered by the camera
+	DUPLICATE_FRAMES,		// Frames the camera delivered again and were skipped
+	FRAMES_PROCESSED,		// Frames that went through detection
+	BACKDROP_UPLOADS,		// Camera frames uploaded to the backdrop texture
+	BACKDROP_REUSES,		// Renders that reused the uploaded backdrop texture
+	LIGHT_ESTIMATES,		// Light directions computed
+	LIGHT_ESTIMATE_REUSES,	// Light directions returned from the cache
+	FRAME_ALLOCATIONS,		// Images allocated by frame pools; flat once running
+	DETECTION_PASSES,		// Threshold passes run by full searches
+	SKIPPED_PASSES,			// Threshold passes skipped because every expected marker was found
+	POSE_SOLVES,			// Iterative pose solves by the continuous pose path
+	SEEDED_POSE_SOLVES,		// Those seeded with last frame's pose
+	SETTLED_POSE_SOLVES,	// Seeded solves capped early because their first residual was already small
+	POSE_ITERATIONS,		// ICP iterations they ran
+	POSE_RESIDUAL,			// Sum of their final mean squared reprojection errors, in 1/1000 px^2
+	MARKERS_DETECTED,		// Markers found by full or ROI detection
+	MARKERS_CORNER_TRACKED,	// Markers followed by corner tracking instead
+	CORNER_TRACKING_TIME,	// Microseconds spent on corner tracking, pyramids included
+	PATTERN_COMPARISONS,	// Pattern bank rows correlated with candidates
+	HINTED_IDENTIFICATIONS,	// Candidates identified from their expected patterns alone
+	HINT_FALLBACKS,			// Hinted candidates that needed the whole bank
+	COUNT					// Number of counters; not a counter
+};
+
+
+
+class Telemetry
+{
+public:
+	Telemetry();
+
+	inline void count(TelemetryCounter counter, unsigned long long amount = 1)
+	{
+		m_counters[(int)counter].fetch_add(amount, std::memory_order_relaxed);
+	}
+
+	inline unsigned long long get(TelemetryCounter counter) const
+	{
+		return m_counters[(int)counter].load(std::memory_order_relaxed);
+	}
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Prints every counter's total and its change since the
+	//				last report.
+	// MUTATES:
+	//	- m_reported
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void report(std::ostream &out);
+
+	void reset();
+
+private:
+	std::atomic<unsigned long long> m_counters[(int)TelemetryCounter::COUNT];
+	unsigned long long m_reported[(int)TelemetryCounter::COUNT];	// Totals at the last report
+};
+
+
+//================================================================================//
+
+
+// The process's counters.
+Telemetry& getTelemetry();
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Name of a counter, as printed by Telemetry::report().
+//---------------------------------------------------------------------------//
+const char* getTelemetryCounterName(TelemetryCounter counter);
\ No newline at end of file
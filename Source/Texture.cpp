@@ -1,32 +1,188 @@
-
-
-#include "Texture.hpp"
-
-Texture::Texture(unsigned int width, unsigned int height)
-{
-	m_width = width;
-	m_height = height;
-	m_colorDepth = RGBA;
-
-	mp_pixels = new ubyte[m_width*m_height*RGBA]; // Default to RGBA
-}
-
-//----------------------------------------------------------------------//
-
-Texture::Texture(unsigned int width, unsigned int height, Texture::ColorDepth depth)
-{
-	m_width = width;
-	m_height = height;
-	m_colorDepth = depth;
-
-	mp_pixels = new ubyte[m_width*m_height*depth]; // Use specified color depth
-}
-
-//----------------------------------------------------------------------//
-
-Texture::~Texture()
-{
-	delete[] mp_pixels;
-}
-
-//----------------------------------------------------------------------//
+#include "Texture.hpp"
+
+#include <cstring>
+#include <cstdlib>
+#include <utility>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+#include "Util.hpp"
+
+Texture::Texture(unsigned int width, unsigned int height)
+{
+	m_width = width;
+	m_height = height;
+	m_colorDepth = RGBA; // Default to RGBA
+
+	allocate(0);
+}
+
+//----------------------------------------------------------------------//
+
+Texture::Texture(unsigned int width, unsigned int height, Texture::ColorDepth depth, unsigned int rowAlignment)
+{
+	m_width = width;
+	m_height = height;
+	m_colorDepth = depth; // Use specified color depth
+
+	allocate(rowAlignment);
+}
+
+//----------------------------------------------------------------------//
+
+Texture::Texture(ubyte* p_externalPixels, unsigned int width, unsigned int height, Texture::ColorDepth depth)
+{
+	m_width = width;
+	m_height = height;
+	m_colorDepth = depth;
+
+	m_stride = width*depth; // Driver buffers are packed
+
+	mp_pixels = p_externalPixels; // Not ours; never deleted
+	m_ownsPixels = false;
+}
+
+//----------------------------------------------------------------------//
+
+Texture::~Texture()
+{
+	freePixels();
+}
+
+//----------------------------------------------------------------------//
+
+Texture::Texture(Texture&& other)
+{
+	mp_pixels = NULL;
+	m_ownsPixels = false;
+	*this = std::move(other);
+}
+
+//----------------------------------------------------------------------//
+
+Texture& Texture::operator=(Texture&& other)
+{
+	if (this != &other)
+	{
+		freePixels();
+
+		mp_pixels = other.mp_pixels;
+		m_ownsPixels = other.m_ownsPixels;
+		m_width = other.m_width;
+		m_height = other.m_height;
+		m_stride = other.m_stride;
+		m_colorDepth = other.m_colorDepth;
+
+		// The moved-from texture is left as an empty view.
+		other.mp_pixels = NULL;
+		other.m_ownsPixels = false;
+	}
+
+	return *this;
+}
+
+//----------------------------------------------------------------------//
+
+void Texture::wrap(ubyte* p_externalPixels)
+{
+	if (m_ownsPixels)
+	{
+		throw(Error::Exception(std::string("Texture::wrap() called on a texture that owns its pixels")));
+	}
+
+	mp_pixels = p_externalPixels;
+}
+
+//----------------------------------------------------------------------//
+
+void Texture::copyFrom(Texture& source)
+{
+	if (source.getWidth() != m_width || source.getHeight() != m_height || source.getColorDepth() != m_colorDepth)
+	{
+		throw(Error::DimensionsMismatchException());
+	}
+
+	if (source.getStride() == m_stride)
+	{
+		memcpy(mp_pixels, source.getPixelBuffer(), getSize());
+		return;
+	}
+
+	for (unsigned int y = 0; y < m_height; y++)
+	{
+		memcpy(getRow(y), source.getRow(y), m_width*m_colorDepth);
+	}
+}
+
+//----------------------------------------------------------------------//
+
+void Texture::copyFrom(const ubyte* p_packedPixels)
+{
+	unsigned int rowSize = m_width*m_colorDepth;
+
+	if (isPacked())
+	{
+		memcpy(mp_pixels, p_packedPixels, getSize());
+		return;
+	}
+
+	for (unsigned int y = 0; y < m_height; y++)
+	{
+		memcpy(getRow(y), p_packedPixels + y*rowSize, rowSize);
+	}
+}
+
+//----------------------------------------------------------------------//
+
+void Texture::allocate(unsigned int rowAlignment)
+{
+	m_stride = m_width*m_colorDepth;
+	if (rowAlignment > 1)
+	{
+		// Rows also end on a whole pixel, so the stride can be given to GL in pixels.
+		unsigned int step = rowAlignment;
+		while (step % m_colorDepth != 0)
+		{
+			step += rowAlignment;
+		}
+		m_stride = (m_stride + step - 1) / step * step;
+	}
+
+	// Rounded up so aligned vector loads over the last row stay inside the buffer.
+	size_t size = ((size_t)m_stride*m_height + PIXEL_ALIGNMENT - 1) / PIXEL_ALIGNMENT * PIXEL_ALIGNMENT;
+
+#ifdef _WIN32
+	mp_pixels = (ubyte*)_aligned_malloc(size, PIXEL_ALIGNMENT);
+#else
+	void* p_memory = NULL;
+	mp_pixels = (posix_memalign(&p_memory, PIXEL_ALIGNMENT, size) == 0) ? (ubyte*)p_memory : NULL;
+#endif
+
+	if (mp_pixels == NULL)
+	{
+		throw(std::bad_alloc());
+	}
+	m_ownsPixels = true;
+}
+
+//----------------------------------------------------------------------//
+
+void Texture::freePixels()
+{
+	if (m_ownsPixels)
+	{
+#ifdef _WIN32
+		_aligned_free(mp_pixels);
+#else
+		free(mp_pixels);
+#endif
+	}
+
+	mp_pixels = NULL;
+	m_ownsPixels = false;
+}
+
+//----------------------------------------------------------------------//
@@ -1,34 +1,71 @@
-#pragma once
-
-#include "TypeDef.hpp"
-
-class Texture
-{
-public:
-	static enum ColorDepth
-	{
-		RGB = 3,
-		RGBA
-	};
-
-	Texture(unsigned int width, unsigned int height);
-	Texture(unsigned int width, unsigned int height, Texture::ColorDepth depth);
-
-	~Texture();
-
-	inline ubyte* getPixelBuffer() { return mp_pixels; }
-	inline unsigned int getWidth() { return m_width; }
-	inline unsigned int getHeight() { return m_height; }
-	inline unsigned int getSize() { return m_height*m_width*m_colorDepth*sizeof(ubyte); }
-	inline ColorDepth getColorDepth() { return m_colorDepth; }
-
-
-private:
-	ubyte* mp_pixels;
-	unsigned int m_width;
-	unsigned int m_height;
-	ColorDepth m_colorDepth;
-};
-typedef Texture Image;
-
+#pragma once
+
+#include "TypeDef.hpp"
+
+// Byte alignment of every buffer a texture allocates: a cache line, and wide enough for AVX-512 loads.
+static const unsigned int PIXEL_ALIGNMENT = 64;
+
+class Texture
+{
+public:
+	static enum ColorDepth
+	{
+		RGB = 3,
+		RGBA
+	};
+
+	Texture(unsigned int width, unsigned int height);
+
+	// rowAlignment: Pads each row to a multiple of this many bytes (e.g. PIXEL_ALIGNMENT);
+	//				 0 packs rows. ARToolKit reads frames as packed, so only pad images it never sees.
+	Texture(unsigned int width, unsigned int height, Texture::ColorDepth depth, unsigned int rowAlignment = 0);
+
+	// Non-owning view over an externally owned buffer (e.g. the video driver's
+	// frame). The buffer must outlive every read made through the view.
+	Texture(ubyte* p_externalPixels, unsigned int width, unsigned int height, Texture::ColorDepth depth);
+
+	~Texture();
+
+	// Textures own their pixels, so they move but do not copy.
+	Texture(Texture&& other);
+	Texture& operator=(Texture&& other);
+	Texture(const Texture&) = delete;
+	Texture& operator=(const Texture&) = delete;
+
+	// Points a view at a new external buffer of the same dimensions.
+	void wrap(ubyte* p_externalPixels);
+
+	// Copies pixels from another texture of the same dimensions. Use this to hold
+	// a view's contents past the lifetime of the buffer it wraps. Strides may differ.
+	void copyFrom(Texture& source);
+
+	// Copies a frame of packed rows, such as a video driver's, into this texture.
+	void copyFrom(const ubyte* p_packedPixels);
+
+	inline bool isView() const { return !m_ownsPixels; }
+	inline ubyte* getPixelBuffer() { return mp_pixels; }
+	inline unsigned int getWidth() { return m_width; }
+	inline unsigned int getHeight() { return m_height; }
+	inline unsigned int getSize() { return m_height*m_stride*sizeof(ubyte); }
+	inline ColorDepth getColorDepth() { return m_colorDepth; }
+
+	// Bytes from the start of one row to the next; width * depth when rows are packed.
+	inline unsigned int getStride() const { return m_stride; }
+	inline bool isPacked() const { return m_stride == m_width*m_colorDepth; }
+	inline ubyte* getRow(unsigned int y) { return mp_pixels + y*m_stride; }
+
+
+private:
+	ubyte* mp_pixels;
+	bool m_ownsPixels;
+	unsigned int m_width;
+	unsigned int m_height;
+	unsigned int m_stride;
+	ColorDepth m_colorDepth;
+
+	void allocate(unsigned int rowAlignment);
+	void freePixels();
+};
+typedef Texture Image;
+
 //----------------------------------------------------------------------//
\ No newline at end of file
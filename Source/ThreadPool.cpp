@@ -0,0 +1,128 @@
+//================================================================================//
+// ThreadPool
+//	- Fixed set of worker threads that run the iterations of a parallel loop.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//================================================================================//
+#include "ThreadPool.hpp"
+
+
+ThreadPool::ThreadPool(unsigned int threadCount)
+{
+	mp_task = NULL;
+	m_taskCount = 0;
+	m_nextTask = 0;
+	m_busyWorkers = 0;
+	m_generation = 0;
+	m_stopping = false;
+
+	if (threadCount == 0)
+	{
+		threadCount = std::thread::hardware_concurrency();
+	}
+
+	// The caller of run() is one of the threads.
+	for (unsigned int i = 1; i < threadCount; i++)
+	{
+		m_workers.push_back(std::thread(&ThreadPool::workerLoop, this));
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stopping = true;
+	}
+	m_workReady.notify_all();
+
+	for (int i = 0; i < m_workers.size(); i++)
+	{
+		m_workers[i].join();
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ThreadPool::run(unsigned int taskCount, const std::function<void(unsigned int)> &task)
+{
+	std::lock_guard<std::mutex> runLock(m_runMutex);
+
+	// Not worth waking anyone for.
+	if (taskCount <= 1 || m_workers.empty())
+	{
+		for (unsigned int i = 0; i < taskCount; i++)
+		{
+			task(i);
+		}
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		mp_task = &task;
+		m_taskCount = taskCount;
+		m_nextTask = 0;
+		m_busyWorkers = (unsigned int)m_workers.size();
+		m_generation++;
+	}
+	m_workReady.notify_all();
+
+	runTasks();
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_workDone.wait(lock, [this] { return m_busyWorkers == 0; });
+	mp_task = NULL;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ThreadPool::workerLoop()
+{
+	unsigned long long generation = 0;
+
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_workReady.wait(lock, [this, generation] { return m_stopping || m_generation != generation; });
+			if (m_stopping)
+			{
+				return;
+			}
+			generation = m_generation;
+		}
+
+		runTasks();
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (--m_busyWorkers == 0)
+			{
+				m_workDone.notify_one();
+			}
+		}
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void ThreadPool::runTasks()
+{
+	unsigned int i;
+	while ((i = m_nextTask.fetch_add(1)) < m_taskCount)
+	{
+		(*mp_task)(i);
+	}
+}
\ No newline at end of file
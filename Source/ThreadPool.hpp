@@ -0,0 +1,56 @@
+//================================================================================//
+// ThreadPool
+//	- Fixed set of worker threads that run the iterations of a parallel loop.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//--------------------------------------------------------------------------------//
+// NOTE: run() hands out task indices from an atomic counter, so fast workers
+//		 take more tasks and uneven tasks balance themselves. The calling
+//		 thread works too, and run() returns once every task has finished.
+//		 run() is not reentrant: a task must not call run() on its own pool.
+//================================================================================//
+#pragma once
+
+#include<vector>
+#include<thread>
+#include<mutex>
+#include<condition_variable>
+#include<atomic>
+#include<functional>
+
+class ThreadPool
+{
+public:
+	// threadCount: Threads that run tasks, including the caller of run(); 0 for one per core.
+	ThreadPool(unsigned int threadCount = 0);
+	~ThreadPool();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Calls task(i) for every i in [0, taskCount), spread
+	//				across the workers and the calling thread.
+	// NOTES: Blocks until every call has returned. Calls from several
+	//		  threads are serialized.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void run(unsigned int taskCount, const std::function<void(unsigned int)> &task);
+
+	// Threads that run tasks, including the caller of run().
+	inline unsigned int getThreadCount() const { return (unsigned int)m_workers.size() + 1; }
+
+private:
+	std::vector<std::thread> m_workers;
+	std::mutex m_runMutex;			// Serializes run()
+	std::mutex m_mutex;
+	std::condition_variable m_workReady;
+	std::condition_variable m_workDone;
+
+	const std::function<void(unsigned int)>* mp_task;
+	unsigned int m_taskCount;
+	std::atomic<unsigned int> m_nextTask;
+	unsigned int m_busyWorkers;			// Workers still inside the current run()
+	unsigned long long m_generation;	// Advances once per run()
+	bool m_stopping;
+
+	void workerLoop();
+	void runTasks();
+};
\ No newline at end of file
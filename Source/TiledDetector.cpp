@@ -0,0 +1,303 @@
+//================================================================================//
+// TiledDetector
+//	- Runs arDetectMarker() on overlapping tiles of a frame in parallel and
+//	  merges their candidates.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//================================================================================//
+#include "TiledDetector.hpp"
+
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+
+#include "MarkerCandidates.hpp"
+
+
+TiledDetector::TiledDetector()
+{
+	m_frameWidth = 0;
+	m_frameHeight = 0;
+	m_pixelSize = 1;
+	m_rows = 1;
+	m_columns = 1;
+	m_overlap = 0;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+TiledDetector::~TiledDetector()
+{
+	destroy();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+bool TiledDetector::init(ARHandle* p_reference, unsigned int rows, unsigned int columns, int overlap)
+{
+	destroy();
+
+	if (p_reference == NULL || p_reference->arParamLT == NULL || rows == 0 || columns == 0 || overlap < 0)
+	{
+		return false;
+	}
+
+	m_frameWidth = p_reference->xsize;
+	m_frameHeight = p_reference->ysize;
+	m_pixelSize = arUtilGetPixelSize(p_reference->arPixelFormat);
+	m_rows = rows;
+	m_columns = columns;
+	m_overlap = overlap;
+
+	for (unsigned int row = 0; row < rows; row++)
+	{
+		for (unsigned int column = 0; column < columns; column++)
+		{
+			// The tile's share of the frame, grown by half the overlap on each inner side.
+			int left = (int)(column * m_frameWidth / columns) - ((column > 0) ? overlap / 2 : 0);
+			int right = (int)((column + 1) * m_frameWidth / columns) + ((column + 1 < columns) ? (overlap + 1) / 2 : 0);
+			int top = (int)(row * m_frameHeight / rows) - ((row > 0) ? overlap / 2 : 0);
+			int bottom = (int)((row + 1) * m_frameHeight / rows) + ((row + 1 < rows) ? (overlap + 1) / 2 : 0);
+
+			DetectionTile tile;
+			tile.x = std::max(left, 0);
+			tile.y = std::max(top, 0);
+			tile.width = std::min(right, m_frameWidth) - tile.x;
+			tile.height = std::min(bottom, m_frameHeight) - tile.y;
+			tile.p_paramLT = NULL;
+			tile.p_handle = NULL;
+			m_tiles.push_back(tile);
+
+			ARParam tileParam;
+			DetectionTile &added = m_tiles.back();
+			if (!makeRegionParam(p_reference->arParamLT->param, added.x, added.y, added.width, added.height, tileParam)
+				|| (added.p_paramLT = arParamLTCreate(&tileParam, AR_PARAM_LT_DEFAULT_OFFSET)) == NULL
+				|| (added.p_handle = createDetectionHandle(p_reference, added.p_paramLT)) == NULL)
+			{
+				std::cout << "Tiled detection could not be initialized; detecting on the full frame." << std::endl;
+				destroy();
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void TiledDetector::destroy()
+{
+	for (int i = 0; i < m_tiles.size(); i++)
+	{
+		deleteDetectionHandle(m_tiles[i].p_handle);
+		if (m_tiles[i].p_paramLT != NULL)
+		{
+			arParamLTFree(&m_tiles[i].p_paramLT);
+		}
+	}
+
+	m_tiles.clear();
+	m_markers.clear();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void TiledDetector::setPixelFormat(AR_PIXEL_FORMAT pixelFormat)
+{
+	m_pixelSize = arUtilGetPixelSize(pixelFormat);
+
+	for (int i = 0; i < m_tiles.size(); i++)
+	{
+		arSetPixelFormat(m_tiles[i].p_handle, pixelFormat);
+		arSetPatternDetectionMode(m_tiles[i].p_handle, (pixelFormat == AR_PIXEL_FORMAT_MONO) ? AR_TEMPLATE_MATCHING_MONO : AR_TEMPLATE_MATCHING_COLOR);
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+ARMarkerInfo* TiledDetector::detect(const ubyte* p_frame, int threshold, int &markerNum, ThreadPool* p_pool)
+{
+	if (p_pool != NULL)
+	{
+		p_pool->run((unsigned int)m_tiles.size(), [this, p_frame, threshold](unsigned int i) { detectTile(i, p_frame, threshold); });
+	}
+	else
+	{
+		for (unsigned int i = 0; i < m_tiles.size(); i++)
+		{
+			detectTile(i, p_frame, threshold);
+		}
+	}
+
+	return mergeTiles(markerNum);
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+ARMarkerInfo* TiledDetector::mergeTiles(int &markerNum)
+{
+	// Merged in tile order, so results do not depend on which thread finished first.
+	m_markers.clear();
+	for (int i = 0; i < m_tiles.size(); i++)
+	{
+		for (int j = 0; j < m_tiles[i].candidates.size(); j++)
+		{
+			mergeCandidate(m_tiles[i].candidates[j]);
+		}
+	}
+
+	markerNum = (int)m_markers.size();
+	return m_markers.data();
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void TiledDetector::detectTile(unsigned int index, const ubyte* p_frame, int threshold)
+{
+	DetectionTile &tile = m_tiles[index];
+	const ubyte* p_tilePixels = p_frame + ((size_t)tile.y * m_frameWidth + tile.x) * m_pixelSize;
+	tile.candidates.clear();
+
+	// Full-width tiles are contiguous rows of the frame; the others are copied out.
+	if (tile.width != m_frameWidth)
+	{
+		size_t rowSize = (size_t)tile.width * m_pixelSize;
+		tile.pixels.resize(rowSize * tile.height);
+
+		for (int y = 0; y < tile.height; y++)
+		{
+			memcpy(&tile.pixels[y * rowSize], p_tilePixels + (size_t)y * m_frameWidth * m_pixelSize, rowSize);
+		}
+		p_tilePixels = tile.pixels.data();
+	}
+
+	arSetLabelingThresh(tile.p_handle, threshold);
+	if (arDetectMarker(tile.p_handle, (ARUint8*)p_tilePixels) < 0)
+	{
+		return;
+	}
+
+	int markerNum = arGetMarkerNum(tile.p_handle);
+	ARMarkerInfo* p_markerInfo = arGetMarker(tile.p_handle);
+	for (int i = 0; i < markerNum; i++)
+	{
+		tile.candidates.push_back(p_markerInfo[i]);
+		translateCandidate(tile.candidates.back(), (ARdouble)tile.x, (ARdouble)tile.y);
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void TiledDetector::mergeCandidate(const ARMarkerInfo &candidate)
+{
+	// Two tiles that see the same square find it within a fraction of a pixel.
+	ARdouble tolerance = std::max((ARdouble)4.0, (ARdouble)0.2 * sqrt((ARdouble)candidate.area));
+
+	for (int i = 0; i < m_markers.size(); i++)
+	{
+		ARdouble dx = m_markers[i].pos[0] - candidate.pos[0];
+		ARdouble dy = m_markers[i].pos[1] - candidate.pos[1];
+
+		if (dx * dx + dy * dy < tolerance * tolerance)
+		{
+			if (candidate.cf > m_markers[i].cf)
+			{
+				m_markers[i] = candidate;
+			}
+			return;
+		}
+	}
+
+	m_markers.push_back(candidate);
+}
+
+
+//================================================================================//
+
+
+bool makeRegionParam(const ARParam &frameParam, int x, int y, int width, int height, ARParam &regionParam)
+{
+	regionParam = frameParam;
+	regionParam.xsize = width;
+	regionParam.ysize = height;
+	regionParam.mat[0][2] -= x;
+	regionParam.mat[1][2] -= y;
+
+	// Version 4 stores the centre as its 7th and 8th factors, older versions as the 1st and 2nd.
+	switch (frameParam.dist_function_version)
+	{
+	case 4:
+		regionParam.dist_factor[6] -= x;
+		regionParam.dist_factor[7] -= y;
+		return true;
+	case 3:
+	case 2:
+	case 1:
+		regionParam.dist_factor[0] -= x;
+		regionParam.dist_factor[1] -= y;
+		return true;
+	default:
+		return false;
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+ARHandle* createDetectionHandle(ARHandle* p_reference, ARParamLT* p_paramLT)
+{
+	ARHandle* p_handle = arCreateHandle(p_paramLT);
+	if (p_handle == NULL)
+	{
+		return NULL;
+	}
+
+	if (p_reference->pattHandle != NULL)
+	{
+		arPattAttach(p_handle, p_reference->pattHandle);
+	}
+	arSetPixelFormat(p_handle, p_reference->arPixelFormat);
+	arSetPatternDetectionMode(p_handle, p_reference->arPatternDetectionMode);
+	arSetLabelingThreshMode(p_handle, AR_LABELING_THRESH_MODE_MANUAL);
+	arSetLabelingThresh(p_handle, p_reference->arLabelingThresh);
+	arSetLabelingMode(p_handle, p_reference->arLabelingMode);
+	arSetImageProcMode(p_handle, p_reference->arImageProcMode);
+	arSetPattRatio(p_handle, p_reference->pattRatio);
+	arSetMatrixCodeType(p_handle, p_reference->matrixCodeType);
+
+	return p_handle;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void deleteDetectionHandle(ARHandle* &p_handle)
+{
+	if (p_handle != NULL)
+	{
+		arPattDetach(p_handle); // The patterns belong to the reference handle.
+		arDeleteHandle(p_handle);
+		p_handle = NULL;
+	}
+}
\ No newline at end of file
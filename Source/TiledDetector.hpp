@@ -0,0 +1,130 @@
+//================================================================================//
+// TiledDetector
+//	- Runs arDetectMarker() on overlapping tiles of a frame in parallel and
+//	  merges their candidates.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//--------------------------------------------------------------------------------//
+// NOTE: Each tile has its own ARHandle and camera parameters: the frame's,
+//		 with the principal point and distortion centre moved to the tile's
+//		 origin. Candidates therefore come out in tile ideal coordinates and
+//		 are translated back to the frame exactly.
+//		 Tiles that span the frame's full width are read in place. Narrower
+//		 tiles are copied out first.
+//		 Neighbouring tiles share overlap pixels. A marker narrower than that
+//		 lies whole inside at least one tile. ARToolKit drops squares that
+//		 touch a tile's edge, and the copies found by two tiles are merged,
+//		 keeping the more confident one.
+//================================================================================//
+#pragma once
+
+#include<AR/ar.h>
+#include<vector>
+
+#include "TypeDef.hpp"
+#include "ThreadPool.hpp"
+
+
+struct DetectionTile
+{
+	int x, y;						// Top left corner in the frame, overlap included
+	int width, height;
+	ARParamLT* p_paramLT;
+	ARHandle* p_handle;
+	std::vector<ubyte> pixels;		// Copy of the region, for tiles narrower than the frame
+	std::vector<ARMarkerInfo> candidates;
+};
+
+
+
+class TiledDetector
+{
+public:
+	TiledDetector();
+	~TiledDetector();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Splits the frame into rows x columns tiles.
+	// OUTPUT: False if a tile's handle could not be created.
+	// INPUT:
+	//	* p_reference: Full-frame handle whose camera parameters, patterns
+	//				   and detection settings every tile copies.
+	//	* overlap: Pixels shared by neighbouring tiles; the widest marker
+	//			   that is always found whole.
+	// NOTES: The patterns stay owned by p_reference, which must outlive
+	//		  the tiles.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool init(ARHandle* p_reference, unsigned int rows, unsigned int columns, int overlap);
+
+	// Deletes every tile's handle and parameters.
+	void destroy();
+
+	// Pixel format of the frames passed to detect().
+	void setPixelFormat(AR_PIXEL_FORMAT pixelFormat);
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Detects markers on every tile, in parallel when a pool
+	//				is provided, and merges the results.
+	// OUTPUT: Candidates in full-frame ideal coordinates, valid until the
+	//		   next call.
+	// INPUT:
+	//	* p_frame: Packed frame with the reference handle's dimensions.
+	//	* p_pool: Runs the tiles; NULL detects them one after another.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	ARMarkerInfo* detect(const ubyte* p_frame, int threshold, int &markerNum, ThreadPool* p_pool);
+
+	// The two halves of detect(), for callers that schedule tiles themselves. Tiles
+	// may be detected concurrently; mergeTiles() runs once all of them have finished.
+	void detectTile(unsigned int index, const ubyte* p_frame, int threshold);
+	ARMarkerInfo* mergeTiles(int &markerNum);
+
+	// GETTERS
+	inline bool isInitialized() const { return !m_tiles.empty(); }
+	inline unsigned int getTileCount() const { return (unsigned int)m_tiles.size(); }
+	inline unsigned int getRows() const { return m_rows; }
+	inline unsigned int getColumns() const { return m_columns; }
+	inline int getOverlap() const { return m_overlap; }
+
+private:
+	std::vector<DetectionTile> m_tiles;
+	std::vector<ARMarkerInfo> m_markers;	// Merged candidates of the last detect()
+	int m_frameWidth;
+	int m_frameHeight;
+	int m_pixelSize;
+	unsigned int m_rows;
+	unsigned int m_columns;
+	int m_overlap;
+
+	// Adds a candidate unless a tile already found the same square.
+	void mergeCandidate(const ARMarkerInfo &candidate);
+};
+
+
+//================================================================================//
+
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Camera parameters of a region of a frame.
+// OUTPUT: False if the distortion model is not supported.
+// ARGUMENTS:
+//	- frameParam: Parameters of the whole frame.
+//	- x, y, width, height: The region.
+//	- regionParam: Receives the frame's parameters with the principal point
+//				   and distortion centre moved by (-x, -y).
+//---------------------------------------------------------------------------//
+bool makeRegionParam(const ARParam &frameParam, int x, int y, int width, int height, ARParam &regionParam);
+
+//---------------------------------------------------------------------------//
+// DESCRIPTION: Creates a handle that detects like another one.
+// OUTPUT: The handle, or NULL if ARToolKit could not create it.
+// ARGUMENTS:
+//	- p_reference: Handle whose patterns (shared, not copied), pixel format
+//				   and detection settings are used.
+//	- p_paramLT: Camera parameters of the new handle; must outlive it.
+// NOTES: The threshold mode is manual; callers set the threshold.
+//---------------------------------------------------------------------------//
+ARHandle* createDetectionHandle(ARHandle* p_reference, ARParamLT* p_paramLT);
+
+// Detaches the shared patterns, deletes the handle and sets it to NULL.
+void deleteDetectionHandle(ARHandle* &p_handle);
\ No newline at end of file
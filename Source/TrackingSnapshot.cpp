@@ -0,0 +1,151 @@
+//================================================================================//
+// TrackingSnapshot
+//	- Immutable record of every marker's tracking results for one frame, and
+//	  the double buffer that publishes one per frame to other threads.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//================================================================================//
+#include "TrackingSnapshot.hpp"
+
+#include <algorithm>
+#include <thread>
+
+
+TrackingSnapshot::TrackingSnapshot()
+{
+	frameSequence = 0;
+	firstID = 0;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void TrackingSnapshot::buildIndex()
+{
+	int lastID = -1;
+	firstID = 0;
+	for (int i = 0; i < markers.size(); i++)
+	{
+		firstID = (i == 0) ? markers[i].markerID : std::min(firstID, markers[i].markerID);
+		lastID = std::max(lastID, markers[i].markerID);
+	}
+
+	slots.assign((lastID >= firstID) ? lastID - firstID + 1 : 0, -1);
+	for (int i = 0; i < markers.size(); i++)
+	{
+		int& slot = slots[markers[i].markerID - firstID];
+		if (slot < 0)
+		{
+			slot = i; // The first of a repeated ID, as a search in load order would find.
+		}
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+float TrackingSnapshot::getError(int markerID) const
+{
+	const MarkerResult* p_result = find(markerID);
+	return (p_result != NULL) ? p_result->error : -1;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+ARPose TrackingSnapshot::getPose(int markerID) const
+{
+	const MarkerResult* p_result = find(markerID);
+	if (p_result == NULL || p_result->error == -1)
+	{
+		return ZERO_MATRIX_4X4;
+	}
+
+	return p_result->pose;
+}
+
+
+ARPose TrackingSnapshot::getOffsetPose(int markerID) const
+{
+	const MarkerResult* p_result = find(markerID);
+	if (p_result == NULL || p_result->error == -1)
+	{
+		return ZERO_MATRIX_4X4;
+	}
+
+	return p_result->offsetPose;
+}
+
+
+//================================================================================//
+
+
+TrackingSnapshotBuffer::TrackingSnapshotBuffer()
+{
+	m_front = 0;
+	m_readers[0] = 0;
+	m_readers[1] = 0;
+	m_publishCount = 0;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+TrackingSnapshot& TrackingSnapshotBuffer::beginWrite()
+{
+	int back = 1 - m_front.load();
+
+	// A reader that registers after this sees the new front and lets go (see TrackingSnapshotReader).
+	while (m_readers[back].load() != 0)
+	{
+		std::this_thread::yield();
+	}
+
+	return m_snapshots[back];
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void TrackingSnapshotBuffer::publish()
+{
+	m_front.store(1 - m_front.load());
+	m_publishCount.fetch_add(1, std::memory_order_release);
+}
+
+
+//================================================================================//
+
+
+TrackingSnapshotReader::TrackingSnapshotReader(const TrackingSnapshotBuffer &buffer)
+	: m_buffer(buffer)
+{
+	// Registering and then confirming the snapshot is still the front one keeps the writer off it.
+	for (;;)
+	{
+		m_index = m_buffer.m_front.load();
+		m_buffer.m_readers[m_index].fetch_add(1);
+		if (m_buffer.m_front.load() == m_index)
+		{
+			break;
+		}
+		m_buffer.m_readers[m_index].fetch_sub(1);
+	}
+
+	mp_snapshot = &m_buffer.m_snapshots[m_index];
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+TrackingSnapshotReader::~TrackingSnapshotReader()
+{
+	m_buffer.m_readers[m_index].fetch_sub(1);
+}
\ No newline at end of file
@@ -0,0 +1,112 @@
+//================================================================================//
+// TrackingSnapshot
+//	- Immutable record of every marker's tracking results for one frame, and
+//	  the double buffer that publishes one per frame to other threads.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//--------------------------------------------------------------------------------//
+// NOTE: Results are kept in load order, with a table from marker ID to
+//		 result, so every lookup by ID is a single index. ARMarker IDs come
+//		 from one counter, so the table spans little more than the markers.
+//		 The buffer has one writer. Readers take the published snapshot with
+//		 a TrackingSnapshotReader and never wait; the writer only waits when
+//		 it needs the buffer a reader still holds from two frames back.
+//================================================================================//
+#pragma once
+
+#include<vector>
+#include<atomic>
+
+#include "ARMarker.hpp"
+#include "TypeDef.hpp"
+
+
+struct TrackingSnapshot
+{
+	unsigned long long frameSequence;	// Camera's sequence number of the frame it describes
+	std::vector<MarkerResult> markers;	// In load order
+	int firstID;						// Lowest marker ID in markers
+	std::vector<int> slots;				// Per marker ID - firstID: index in markers, or -1
+
+	TrackingSnapshot();
+
+	// Rebuilds slots from markers; call after changing the markers' IDs.
+	void buildIndex();
+
+	// Result for the marker with the provided ID, or NULL.
+	inline const MarkerResult* find(int markerID) const
+	{
+		unsigned int slot = (unsigned int)(markerID - firstID);
+		return (slot < slots.size() && slots[slot] >= 0) ? &markers[slots[slot]] : NULL;
+	}
+
+	// Error of the marker with the provided ID, -1 if it is not valid.
+	float getError(int markerID) const;
+
+	// Poses of the marker with the provided ID, ZERO_MATRIX_4X4 if it is not valid.
+	ARPose getPose(int markerID) const;
+	ARPose getOffsetPose(int markerID) const;
+};
+
+
+//--------------------------------------------------------------------------------//
+
+
+class TrackingSnapshotBuffer
+{
+public:
+	TrackingSnapshotBuffer();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Takes the snapshot behind the published one, to be
+	//				filled for the next frame.
+	// OUTPUT: Snapshot holding whatever was published two frames back;
+	//		   readers cannot see it until publish().
+	// NOTES: Waits while a reader still holds it. Only one thread may
+	//		  write.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	TrackingSnapshot& beginWrite();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Makes the snapshot from beginWrite() the one readers
+	//				take.
+	// MUTATES:
+	//	- m_front
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void publish();
+
+	// Snapshots published so far.
+	inline unsigned long long getPublishCount() const { return m_publishCount.load(std::memory_order_acquire); }
+
+private:
+	friend class TrackingSnapshotReader;
+
+	TrackingSnapshot m_snapshots[2];
+	std::atomic<int> m_front;				// Snapshot readers take
+	mutable std::atomic<int> m_readers[2];	// Readers holding each snapshot
+	std::atomic<unsigned long long> m_publishCount;
+};
+
+
+//--------------------------------------------------------------------------------//
+
+
+// Holds the published snapshot, unchanged, for as long as it exists; keep it short lived.
+class TrackingSnapshotReader
+{
+public:
+	TrackingSnapshotReader(const TrackingSnapshotBuffer &buffer);
+	~TrackingSnapshotReader();
+
+	inline const TrackingSnapshot& operator*() const { return *mp_snapshot; }
+	inline const TrackingSnapshot* operator->() const { return mp_snapshot; }
+
+private:
+	const TrackingSnapshotBuffer& m_buffer;
+	const TrackingSnapshot* mp_snapshot;
+	int m_index;
+
+	TrackingSnapshotReader(const TrackingSnapshotReader&) = delete;
+	TrackingSnapshotReader& operator=(const TrackingSnapshotReader&) = delete;
+};
\ No newline at end of file
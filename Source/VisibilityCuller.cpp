@@ -0,0 +1,74 @@
+//================================================================================//
+// VisibilityCuller
+//	- Decides which faces of a rigid marker body face the camera and lie in
+//	  the frame, from the body's pose alone.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//================================================================================//
+#include "VisibilityCuller.hpp"
+
+#include <cmath>
+
+
+VisibilityCuller::VisibilityCuller()
+{
+
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void VisibilityCuller::setFaces(const std::vector<ARPose> &offsets)
+{
+	size_t count = offsets.size();
+	m_centreX.resize(count); m_centreY.resize(count); m_centreZ.resize(count);
+	m_normalX.resize(count); m_normalY.resize(count); m_normalZ.resize(count);
+
+	for (size_t i = 0; i < count; i++)
+	{
+		// The face's frame in body coordinates: its origin is the centre, its z axis the normal.
+		ARPose faceToBody = glm::inverse(offsets[i]);
+		glm::dvec3 normal = glm::normalize(glm::dvec3(faceToBody[2]));
+
+		m_centreX[i] = faceToBody[3].x;
+		m_centreY[i] = faceToBody[3].y;
+		m_centreZ[i] = faceToBody[3].z;
+		m_normalX[i] = normal.x;
+		m_normalY[i] = normal.y;
+		m_normalZ[i] = normal.z;
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+void VisibilityCuller::cull(const ARdouble bodyTransform[3][4], const ARParam &param,
+	std::vector<float> &facing, std::vector<char> &inFrame) const
+{
+	const ARdouble (*t)[4] = bodyTransform;
+	size_t count = m_centreX.size();
+	facing.resize(count);
+	inFrame.resize(count);
+
+	for (size_t i = 0; i < count; i++)
+	{
+		double cx = t[0][0] * m_centreX[i] + t[0][1] * m_centreY[i] + t[0][2] * m_centreZ[i] + t[0][3];
+		double cy = t[1][0] * m_centreX[i] + t[1][1] * m_centreY[i] + t[1][2] * m_centreZ[i] + t[1][3];
+		double cz = t[2][0] * m_centreX[i] + t[2][1] * m_centreY[i] + t[2][2] * m_centreZ[i] + t[2][3];
+		double nx = t[0][0] * m_normalX[i] + t[0][1] * m_normalY[i] + t[0][2] * m_normalZ[i];
+		double ny = t[1][0] * m_normalX[i] + t[1][1] * m_normalY[i] + t[1][2] * m_normalZ[i];
+		double nz = t[2][0] * m_normalX[i] + t[2][1] * m_normalY[i] + t[2][2] * m_normalZ[i];
+
+		// The camera is at the origin, so the direction to it is -centre.
+		double distance = sqrt(cx * cx + cy * cy + cz * cz);
+		facing[i] = (distance > 0) ? (float)(-(nx * cx + ny * cy + nz * cz) / distance) : -1.0f;
+
+		double u = param.mat[0][0] * cx + param.mat[0][1] * cy + param.mat[0][2] * cz + param.mat[0][3];
+		double v = param.mat[1][0] * cx + param.mat[1][1] * cy + param.mat[1][2] * cz + param.mat[1][3];
+		double w = param.mat[2][0] * cx + param.mat[2][1] * cy + param.mat[2][2] * cz + param.mat[2][3];
+		inFrame[i] = cz > 0 && w > 0 && u >= 0 && v >= 0 && u < param.xsize * w && v < param.ysize * w;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+//================================================================================//
+// VisibilityCuller
+//	- Decides which faces of a rigid marker body face the camera and lie in
+//	  the frame, from the body's pose alone.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//--------------------------------------------------------------------------------//
+// NOTE: Face centres and outward normals are kept in body coordinates, one
+//		 array per component, so every face is rotated, translated and
+//		 tested in one loop over contiguous data. A face's facing value is
+//		 the cosine between its normal and the direction to the camera:
+//		 above 0 it is front-facing, and 1 means it faces the camera head on.
+//		 Poses follow ARToolKit's convention (camera from body, camera
+//		 looking along +z), the same as m_rigidBodyTransform.
+//================================================================================//
+#pragma once
+
+#include<vector>
+
+#include<AR/ar.h>
+
+#include "TypeDef.hpp"
+
+
+class VisibilityCuller
+{
+public:
+	VisibilityCuller();
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Sets the faces to test.
+	// INPUT:
+	//	* offsets: Per face, the marker offset from its pose to the body's
+	//	  (camera from face = camera from body * offset^-1).
+	// MUTATES:
+	//	- m_centre*, m_normal*
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void setFaces(const std::vector<ARPose> &offsets);
+
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// DESCRIPTION: Tests every face against a pose of the body.
+	// INPUT:
+	//	* bodyTransform: Camera from body, as ARToolKit returns it.
+	//	* param: Camera parameters; a face is in frame when its centre
+	//	  projects inside param.xsize x param.ysize.
+	//	* facing: Receives each face's facing cosine.
+	//	* inFrame: Receives whether each face's centre is in the frame.
+	//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void cull(const ARdouble bodyTransform[3][4], const ARParam &param,
+		std::vector<float> &facing, std::vector<char> &inFrame) const;
+
+	inline unsigned int getFaceCount() const { return (unsigned int)m_centreX.size(); }
+
+private:
+	std::vector<double> m_centreX, m_centreY, m_centreZ;	// Body coordinates
+	std::vector<double> m_normalX, m_normalY, m_normalZ;	// Unit length, outward
+};
\ No newline at end of file
@@ -0,0 +1,191 @@
+//================================================================================//
+// DetectionBenchmark
+//	- Measures how tiled marker detection and the labeling engine scale with
+//	  thread count at 720p, 1080p and 4K.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//--------------------------------------------------------------------------------//
+// NOTE: Usage: DetectionBenchmark [frames per run] [max threads] [overlap]
+//		 Frames are synthetic luma images holding a grid of black-bordered
+//		 squares, detected as AR_PIXEL_FORMAT_MONO with ideal camera
+//		 parameters. Each thread count t runs t horizontal tiles on a pool of
+//		 t threads, and the labeling engine 2t row bands; the engine only
+//		 labels and fits quads, without identifying patterns. The baseline is
+//		 one arDetectMarker() over the whole frame.
+//		 Build it with Source/TiledDetector.cpp, Source/ThreadPool.cpp,
+//		 Source/LabelingEngine.cpp and Source/MarkerCandidates.cpp, linked
+//		 against ARToolKit's AR library.
+//================================================================================//
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+#include <cstdlib>
+
+#include <AR/ar.h>
+
+#include "../Source/TiledDetector.hpp"
+#include "../Source/ThreadPool.hpp"
+#include "../Source/LabelingEngine.hpp"
+
+
+struct Resolution
+{
+	const char* name;
+	int width;
+	int height;
+};
+
+
+//--------------------------------------------------------------------------------//
+
+
+// Grey frame with a grid of squares: a black border around a light interior, like a marker.
+static void drawFrame(std::vector<ubyte> &frame, int width, int height)
+{
+	frame.assign((size_t)width * height, 160);
+
+	int size = height / 8;
+	int border = size / 4;
+	for (int top = size / 2; top + size < height; top += 2 * size)
+	{
+		for (int left = size / 2; left + size < width; left += 2 * size)
+		{
+			for (int y = 0; y < size; y++)
+			{
+				for (int x = 0; x < size; x++)
+				{
+					bool inside = (x >= border && x < size - border && y >= border && y < size - border);
+					frame[(size_t)(top + y) * width + left + x] = inside ? 230 : 20;
+				}
+			}
+		}
+	}
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+static double medianMilliseconds(std::vector<double> &times)
+{
+	std::sort(times.begin(), times.end());
+	return times[times.size() / 2];
+}
+
+
+//================================================================================//
+
+
+int main(int argc, char** argv)
+{
+	int frames = (argc > 1) ? atoi(argv[1]) : 30;
+	unsigned int maxThreads = (argc > 2) ? (unsigned int)atoi(argv[2]) : std::thread::hardware_concurrency();
+	int overlap = (argc > 3) ? atoi(argv[3]) : 64;
+	const int threshold = 100;
+
+	if (frames < 1 || maxThreads < 1 || overlap < 0)
+	{
+		std::cout << "Usage: DetectionBenchmark [frames per run] [max threads] [overlap]" << std::endl;
+		return 1;
+	}
+
+	const Resolution resolutions[] = { { "720p", 1280, 720 }, { "1080p", 1920, 1080 }, { "4K", 3840, 2160 } };
+	std::vector<ubyte> frame;
+	ARPattHandle* p_patterns = arPattCreateHandle(); // Empty: squares are found but not identified.
+
+	std::cout << std::fixed << std::setprecision(2);
+
+	for (const Resolution &resolution : resolutions)
+	{
+		ARParam param;
+		arParamClear(&param, resolution.width, resolution.height, AR_DIST_FUNCTION_VERSION_DEFAULT);
+		ARParamLT* p_paramLT = arParamLTCreate(&param, AR_PARAM_LT_DEFAULT_OFFSET);
+		ARHandle* p_handle = (p_paramLT != NULL) ? arCreateHandle(p_paramLT) : NULL;
+		if (p_handle == NULL)
+		{
+			std::cout << "ERROR: Could not create a handle for " << resolution.name << "." << std::endl;
+			return 1;
+		}
+
+		arPattAttach(p_handle, p_patterns);
+		arSetPixelFormat(p_handle, AR_PIXEL_FORMAT_MONO);
+		arSetPatternDetectionMode(p_handle, AR_TEMPLATE_MATCHING_MONO);
+		arSetLabelingThreshMode(p_handle, AR_LABELING_THRESH_MODE_MANUAL);
+		arSetLabelingThresh(p_handle, threshold);
+
+		drawFrame(frame, resolution.width, resolution.height);
+
+		// BASELINE: the whole frame on one thread
+		std::vector<double> times;
+		for (int i = 0; i < frames; i++)
+		{
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			arDetectMarker(p_handle, frame.data());
+			times.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+		}
+		double baseline = medianMilliseconds(times);
+
+		std::cout << resolution.name << " (" << resolution.width << "x" << resolution.height << ")" << std::endl;
+		std::cout << "  whole frame      " << std::setw(8) << baseline << " ms   " << arGetMarkerNum(p_handle) << " squares" << std::endl;
+
+		// TILED: t bands on t threads
+		for (unsigned int threads = 1; threads <= maxThreads; threads++)
+		{
+			ThreadPool pool(threads);
+			TiledDetector detector;
+			if (!detector.init(p_handle, threads, 1, overlap))
+			{
+				continue;
+			}
+
+			int markerNum = 0;
+			times.clear();
+			for (int i = 0; i < frames; i++)
+			{
+				std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+				detector.detect(frame.data(), threshold, markerNum, &pool);
+				times.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+			}
+			double tiled = medianMilliseconds(times);
+
+			std::cout << "  " << std::setw(2) << threads << " thread(s)     " << std::setw(8) << tiled << " ms   "
+				<< markerNum << " squares   x" << baseline / tiled << std::endl;
+		}
+
+		// ENGINE: 2t bands on t threads
+		for (unsigned int threads = 1; threads <= maxThreads; threads++)
+		{
+			ThreadPool pool(threads);
+			LabelingEngine engine;
+			if (!engine.init(resolution.width, resolution.height, 2 * threads))
+			{
+				continue;
+			}
+
+			std::vector<ComponentQuad> quads;
+			times.clear();
+			for (int i = 0; i < frames; i++)
+			{
+				std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+				engine.detect(frame.data(), threshold, &pool, quads);
+				times.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+			}
+			double labeled = medianMilliseconds(times);
+
+			std::cout << "  " << std::setw(2) << threads << " thread(s) engine" << std::setw(8) << labeled << " ms   "
+				<< quads.size() << " squares   x" << baseline / labeled << std::endl;
+		}
+
+		arPattDetach(p_handle);
+		arDeleteHandle(p_handle);
+		arParamLTFree(&p_paramLT);
+	}
+
+	arPattDeleteHandle(p_patterns);
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,167 @@
+//================================================================================//
+// MatrixFaceGenerator
+//	- Writes printable matrix-code marker faces, and the marker file entries
+//	  that load them, for a dodecahedron or any other set of faces.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//--------------------------------------------------------------------------------//
+// NOTE: Usage: MatrixFaceGenerator <code type> [first ID] [faces] [cell pixels]
+//				[pattern ratio] [output prefix]
+//		 Writes <prefix>_<ID>.pgm for every face, <prefix>_Sheet.pgm with all
+//		 of them laid out four to a row, and <prefix>.yaml with their entries
+//		 for the marker file; each face's Offset still has to be added, as
+//		 in "Markers - Gray.yaml". The pattern ratio must match the one
+//		 ARManager's handle uses (ARToolKit's default is 0.5). Each face is
+//		 surrounded by a white margin as wide as its border.
+//		 Build it with Source/MatrixCode.cpp, linked against ARToolKit's AR
+//		 library.
+//================================================================================//
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <cstdlib>
+
+#include <AR/ar.h>
+
+#include "../Source/MatrixCode.hpp"
+
+
+static const int SHEET_COLUMNS = 4;
+
+
+//--------------------------------------------------------------------------------//
+
+
+// A face with its margin: border, code cells, border, all square.
+static bool drawFace(MatrixCodeType type, int id, int cellPixels, double pattRatio, std::vector<ubyte> &pixels, int &size)
+{
+	std::vector<char> cells;
+	if (!encodeMatrixCode(type, id, cells))
+	{
+		return false;
+	}
+
+	int dimension = getMatrixCodeDimension(type);
+	int interior = dimension * cellPixels;
+	int border = (int)(interior / pattRatio + 0.5);
+	border = (border - interior + 1) / 2;
+	int margin = border;
+	size = interior + 2 * (border + margin);
+
+	pixels.assign((size_t)size * size, 255);
+	for (int y = margin; y < size - margin; y++)
+	{
+		for (int x = margin; x < size - margin; x++)
+		{
+			int cx = x - margin - border, cy = y - margin - border;
+			bool inside = cx >= 0 && cy >= 0 && cx < interior && cy < interior;
+			bool dark = !inside || cells[(cy / cellPixels) * dimension + cx / cellPixels];
+			pixels[(size_t)y * size + x] = dark ? 0 : 255;
+		}
+	}
+
+	return true;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+static bool writePGM(const std::string &path, const std::vector<ubyte> &pixels, int width, int height)
+{
+	std::ofstream file(path, std::ios::binary);
+	if (!file)
+	{
+		std::cout << "ERROR: Could not write " << path << "." << std::endl;
+		return false;
+	}
+
+	file << "P5\n" << width << " " << height << "\n255\n";
+	file.write((const char*)pixels.data(), pixels.size());
+	return (bool)file;
+}
+
+
+//================================================================================//
+
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		std::cout << "Usage: MatrixFaceGenerator <3x3|3x3_parity|4x4|4x4_hamming|5x5|5x5_hamming|6x6_hamming> "
+			"[first ID] [faces] [cell pixels] [pattern ratio] [output prefix]" << std::endl;
+		return 1;
+	}
+
+	std::string typeName = argv[1];
+	MatrixCodeType type = parseMatrixCodeType(typeName);
+	int firstID = (argc > 2) ? atoi(argv[2]) : 0;
+	int faces = (argc > 3) ? atoi(argv[3]) : 12;
+	int cellPixels = (argc > 4) ? atoi(argv[4]) : 40;
+	double pattRatio = (argc > 5) ? atof(argv[5]) : 0.5;
+	std::string prefix = (argc > 6) ? argv[6] : "Face";
+
+	if (type == MatrixCodeType::INVALID)
+	{
+		std::cout << "ERROR: Unknown code type \"" << typeName << "\"." << std::endl;
+		return 1;
+	}
+	if (firstID < 0 || faces <= 0 || firstID + faces > getMatrixCodeCapacity(type))
+	{
+		std::cout << "ERROR: " << typeName << " holds IDs 0 to " << getMatrixCodeCapacity(type) - 1 << "." << std::endl;
+		return 1;
+	}
+	if (cellPixels <= 0 || pattRatio <= 0.0 || pattRatio >= 1.0)
+	{
+		std::cout << "ERROR: Invalid cell size or pattern ratio." << std::endl;
+		return 1;
+	}
+
+	std::ofstream markerFile(prefix + ".yaml");
+	markerFile << "# Matrix-code faces from MatrixFaceGenerator; add each face's 'Offset'." << std::endl;
+
+	std::vector<ubyte> face, sheet;
+	int faceSize = 0;
+	int rows = (faces + SHEET_COLUMNS - 1) / SHEET_COLUMNS;
+
+	for (int i = 0; i < faces; i++)
+	{
+		int id = firstID + i;
+		drawFace(type, id, cellPixels, pattRatio, face, faceSize);
+		if (!writePGM(prefix + "_" + std::to_string(id) + ".pgm", face, faceSize, faceSize))
+		{
+			return 1;
+		}
+
+		// SHEET
+		int sheetWidth = SHEET_COLUMNS * faceSize;
+		if (sheet.empty())
+		{
+			sheet.assign((size_t)sheetWidth * rows * faceSize, 255);
+		}
+		int left = (i % SHEET_COLUMNS) * faceSize, top = (i / SHEET_COLUMNS) * faceSize;
+		for (int y = 0; y < faceSize; y++)
+		{
+			std::copy(face.begin() + (size_t)y * faceSize, face.begin() + (size_t)(y + 1) * faceSize,
+				sheet.begin() + (size_t)(top + y) * sheetWidth + left);
+		}
+
+		markerFile << "-" << std::endl;
+		markerFile << " Type : Matrix Code" << std::endl;
+		markerFile << " Barcode ID : " << id << std::endl;
+		markerFile << " Code Type : " << typeName << std::endl;
+		markerFile << " Name : \"Side_" << (i + 1) << "\"" << std::endl;
+	}
+
+	if (!writePGM(prefix + "_Sheet.pgm", sheet, SHEET_COLUMNS * faceSize, rows * faceSize))
+	{
+		return 1;
+	}
+
+	std::cout << "Wrote " << faces << " " << typeName << " faces of " << faceSize << " pixels to " << prefix << "_*.pgm and " << prefix << ".yaml." << std::endl;
+
+	return 0;
+}
\ No newline at end of file
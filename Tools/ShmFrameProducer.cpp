@@ -0,0 +1,140 @@
+//================================================================================//
+// ShmFrameProducer
+//	- Reference producer for the "shared memory" frame source. Publishes a
+//	  synthetic moving pattern into a SharedFrameRing.
+//--------------------------------------------------------------------------------//
+// DATE: 10.18.2026
+// COMPILER: Microsoft Visual C++
+//--------------------------------------------------------------------------------//
+// NOTE: Usage: ShmFrameProducer <name> [width] [height] [fps] [pixel format]
+//		 A real producer opens the camera in place of drawPattern() and
+//		 copies, or captures directly, into the buffer beginWrite() returns.
+//		 Build it with Source/SharedFrameRing.cpp.
+//================================================================================//
+#include <iostream>
+#include <string>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <csignal>
+#include <cstdlib>
+
+#include <AR/ar.h>
+
+#include "../Source/SharedFrameRing.hpp"
+
+
+static std::atomic<bool> g_running(true);
+
+
+static void onSignal(int)
+{
+	g_running = false;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+static int parseFormat(const std::string &text, int &bytesPerPixel)
+{
+	if (text == "mono")	{ bytesPerPixel = 1; return AR_PIXEL_FORMAT_MONO; }
+	if (text == "bgra")	{ bytesPerPixel = 4; return AR_PIXEL_FORMAT_BGRA; }
+	if (text == "rgba")	{ bytesPerPixel = 4; return AR_PIXEL_FORMAT_RGBA; }
+	if (text == "bgr")	{ bytesPerPixel = 3; return AR_PIXEL_FORMAT_BGR; }
+	if (text == "rgb")	{ bytesPerPixel = 3; return AR_PIXEL_FORMAT_RGB; }
+
+	bytesPerPixel = 0;
+	return AR_PIXEL_FORMAT_INVALID;
+}
+
+
+//--------------------------------------------------------------------------------//
+
+
+// Diagonal gradient with a dark square that sweeps across the frame.
+static void drawPattern(ubyte* p_pixels, int width, int height, int bytesPerPixel, uint64_t frame)
+{
+	int size = height / 4;
+	int left = (int)((frame * 4) % (uint64_t)(width - size));
+	int top = (height - size) / 2;
+
+	for (int y = 0; y < height; y++)
+	{
+		ubyte* p_row = p_pixels + (size_t)y * width * bytesPerPixel;
+		bool inRows = (y >= top && y < top + size);
+
+		for (int x = 0; x < width; x++)
+		{
+			ubyte value = (inRows && x >= left && x < left + size) ? 16 : (ubyte)(128 + ((x + y) & 63));
+			for (int c = 0; c < bytesPerPixel; c++)
+			{
+				p_row[x * bytesPerPixel + c] = (bytesPerPixel == 4 && c == 3) ? 255 : value;
+			}
+		}
+	}
+}
+
+
+//================================================================================//
+
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		std::cout << "Usage: ShmFrameProducer <name> [width] [height] [fps] [mono|rgb|bgr|rgba|bgra]" << std::endl;
+		return 1;
+	}
+
+	std::string name = argv[1];
+	int width = (argc > 2) ? atoi(argv[2]) : 640;
+	int height = (argc > 3) ? atoi(argv[3]) : 480;
+	double fps = (argc > 4) ? atof(argv[4]) : 30.0;
+	int bytesPerPixel;
+	int pixelFormat = parseFormat((argc > 5) ? argv[5] : "bgra", bytesPerPixel);
+
+	if (width <= 0 || height <= 0 || fps <= 0.0 || pixelFormat == AR_PIXEL_FORMAT_INVALID)
+	{
+		std::cout << "ERROR: Invalid frame size, rate, or pixel format." << std::endl;
+		return 1;
+	}
+
+	SharedFrameRing ring;
+	if (!ring.create(name, width, height, pixelFormat, bytesPerPixel))
+	{
+		return 1;
+	}
+
+	signal(SIGINT, onSignal);
+	signal(SIGTERM, onSignal);
+
+	std::cout << "Publishing " << width << "x" << height << " at " << fps << " fps to \"" << name << "\". Ctrl+C to stop." << std::endl;
+
+	std::chrono::steady_clock::duration period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / fps));
+	std::chrono::steady_clock::time_point next = std::chrono::steady_clock::now();
+	uint64_t frame = 0, dropped = 0;
+
+	while (g_running)
+	{
+		ubyte* p_pixels = ring.beginWrite();
+		if (p_pixels != NULL)
+		{
+			drawPattern(p_pixels, width, height, bytesPerPixel, frame);
+			ring.publish(getSharedFrameTime());
+		}
+		else
+		{
+			dropped++; // Every slot is held by a consumer.
+		}
+
+		frame++;
+		next += period;
+		std::this_thread::sleep_until(next);
+	}
+
+	std::cout << "Published " << (frame - dropped) << " frames, dropped " << dropped << "." << std::endl;
+	ring.close();
+
+	return 0;
+}
\ No newline at end of file